@@ -29,6 +29,8 @@ string PhysicalOperatorToString(PhysicalOperatorType type) {
 		return "STREAMING_SAMPLE";
 	case PhysicalOperatorType::TOP_N:
 		return "TOP_N";
+	case PhysicalOperatorType::PARTITIONED_TOP_N:
+		return "PARTITIONED_TOP_N";
 	case PhysicalOperatorType::WINDOW:
 		return "WINDOW";
 	case PhysicalOperatorType::STREAMING_WINDOW:
@@ -41,6 +43,8 @@ string PhysicalOperatorToString(PhysicalOperatorType type) {
 		return "HASH_GROUP_BY";
 	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
 		return "PERFECT_HASH_GROUP_BY";
+	case PhysicalOperatorType::STREAMING_GROUP_BY:
+		return "STREAMING_GROUP_BY";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -9,6 +9,10 @@ MergeSorter::MergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
 }
 
 void MergeSorter::PerformInMergeRound() {
+	if (state.range_merge) {
+		PerformRangeMerge();
+		return;
+	}
 	while (true) {
 		{
 			lock_guard<mutex> pair_guard(state.lock);
@@ -44,23 +48,16 @@ void MergeSorter::MergePartition() {
 #endif
 	// Set up the write block
 	// Each merge task produces a SortedBlock with exactly state.block_capacity rows or less
-	result->InitializeWrite();
+	const idx_t count = MinValue(left->Remaining() + right->Remaining(), state.block_capacity);
+	result->InitializeWrite(count);
 	// Initialize arrays to store merge data
 	bool left_smaller[STANDARD_VECTOR_SIZE];
 	idx_t next_entry_sizes[STANDARD_VECTOR_SIZE];
 	// Merge loop
-#ifdef DEBUG
-	auto l_count = left->Remaining();
-	auto r_count = right->Remaining();
-#endif
-	while (true) {
+	for (idx_t merged = 0; merged < count;) {
 		auto l_remaining = left->Remaining();
 		auto r_remaining = right->Remaining();
-		if (l_remaining + r_remaining == 0) {
-			// Done
-			break;
-		}
-		const idx_t next = MinValue(l_remaining + r_remaining, (idx_t)STANDARD_VECTOR_SIZE);
+		const idx_t next = MinValue(count - merged, (idx_t)STANDARD_VECTOR_SIZE);
 		if (l_remaining != 0 && r_remaining != 0) {
 			// Compute the merge (not needed if one side is exhausted)
 			ComputeMerge(next, left_smaller);
@@ -75,10 +72,95 @@ void MergeSorter::MergePartition() {
 		MergeData(*result->payload_data, *left_block.payload_data, *right_block.payload_data, next, left_smaller,
 		          next_entry_sizes, false);
 		D_ASSERT(result->radix_sorting_data.size() == result->payload_data->data_blocks.size());
+		merged += next;
 	}
-#ifdef DEBUG
-	D_ASSERT(result->Count() == l_count + r_count);
-#endif
+	D_ASSERT(result->Count() == count);
+}
+
+void MergeSorter::PerformRangeMerge() {
+	vector<unique_ptr<SortedBlock>> runs;
+	vector<idx_t> run_entries;
+	while (true) {
+		idx_t range_idx;
+		{
+			lock_guard<mutex> range_guard(state.lock);
+			if (state.range_idx == state.num_ranges) {
+				break;
+			}
+			// The ranges are sliced in order, which allows slicing to release the blocks of the previous ranges
+			range_idx = state.range_idx++;
+			GetRange(range_idx, runs, run_entries);
+		}
+		MergeRange(runs, run_entries, state.sorted_blocks_temp[range_idx]);
+	}
+}
+
+void MergeSorter::GetRange(idx_t range_idx, vector<unique_ptr<SortedBlock>> &runs, vector<idx_t> &run_entries) {
+	runs.clear();
+	run_entries.clear();
+	for (idx_t block_idx = 0; block_idx < state.sorted_blocks.size(); block_idx++) {
+		auto &bounds = state.range_bounds[block_idx];
+		const auto start = bounds[range_idx];
+		const auto end = bounds[range_idx + 1];
+		if (start == end) {
+			continue;
+		}
+		idx_t entry_idx;
+		runs.push_back(state.sorted_blocks[block_idx]->CreateSlice(start, end, entry_idx));
+		run_entries.push_back(entry_idx);
+	}
+}
+
+void MergeSorter::MergeRange(vector<unique_ptr<SortedBlock>> &runs, vector<idx_t> &run_entries,
+                             vector<unique_ptr<SortedBlock>> &result_blocks) {
+	if (runs.empty()) {
+		return;
+	}
+	// Merge pairs of runs until two runs are left
+	while (runs.size() > 2) {
+		vector<unique_ptr<SortedBlock>> next_runs;
+		vector<idx_t> next_entries;
+		for (idx_t run_idx = 0; run_idx + 1 < runs.size(); run_idx += 2) {
+			vector<unique_ptr<SortedBlock>> merged_blocks;
+			MergeRuns(*runs[run_idx], run_entries[run_idx], *runs[run_idx + 1], run_entries[run_idx + 1],
+			          merged_blocks);
+			runs[run_idx] = nullptr;
+			runs[run_idx + 1] = nullptr;
+			next_runs.push_back(make_uniq<SortedBlock>(buffer_manager, state));
+			next_runs.back()->AppendSortedBlocks(merged_blocks);
+			next_entries.push_back(0);
+		}
+		if (runs.size() % 2 == 1) {
+			next_runs.push_back(std::move(runs.back()));
+			next_entries.push_back(run_entries.back());
+		}
+		runs = std::move(next_runs);
+		run_entries = std::move(next_entries);
+	}
+	// The last merge writes the result (a single run is merged with an empty run, which copies it)
+	SortedBlock empty_run(buffer_manager, state);
+	auto &right_run = runs.size() == 2 ? *runs[1] : empty_run;
+	const auto right_entry = runs.size() == 2 ? run_entries[1] : 0;
+	MergeRuns(*runs[0], run_entries[0], right_run, right_entry, result_blocks);
+	runs.clear();
+	run_entries.clear();
+}
+
+void MergeSorter::MergeRuns(SortedBlock &l_run, idx_t l_entry, SortedBlock &r_run, idx_t r_entry,
+                            vector<unique_ptr<SortedBlock>> &result_blocks) {
+	left = make_uniq<SBScanState>(buffer_manager, state);
+	left->sb = &l_run;
+	left->SetIndices(0, l_entry);
+	right = make_uniq<SBScanState>(buffer_manager, state);
+	right->sb = &r_run;
+	right->SetIndices(0, r_entry);
+	while (left->Remaining() + right->Remaining() > 0) {
+		result_blocks.push_back(make_uniq<SortedBlock>(buffer_manager, state));
+		result = result_blocks.back().get();
+		MergePartition();
+	}
+	left = nullptr;
+	right = nullptr;
 }
 
 void MergeSorter::GetNextPartition() {
@@ -363,7 +363,7 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), range_merge(false), range_idx(0), num_ranges(0) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -450,11 +450,129 @@ void GlobalSortState::InitializeMergeRound() {
 	}
 }
 
+//! Returns a pointer to the radix sorting data of a row in a sorted block
+static data_ptr_t GetRadixPtr(SBScanState &scan, idx_t row_idx) {
+	idx_t block_idx;
+	idx_t entry_idx;
+	scan.sb->GlobalToLocalIndex(row_idx, block_idx, entry_idx);
+	scan.SetIndices(block_idx, entry_idx);
+	scan.PinRadix(block_idx);
+	return scan.RadixPtr();
+}
+
+bool GlobalSortState::InitializeRangeMerge(idx_t range_count) {
+	D_ASSERT(sorted_blocks_temp.empty());
+	idx_t total_count = 0;
+	for (auto &sb : sorted_blocks) {
+		total_count += sb->Count();
+	}
+	range_count = MinValue(range_count, total_count / STANDARD_VECTOR_SIZE);
+	if (range_count <= 1) {
+		return false;
+	}
+	// The radix sorting data can be compared with memcmp up to (and including) the first variable size column
+	// Splitting the keys on this prefix puts rows that are equal (or tied) on this prefix in the same range
+	idx_t prefix_size = 0;
+	for (idx_t col_idx = 0; col_idx < sort_layout.column_count; col_idx++) {
+		prefix_size += sort_layout.column_sizes[col_idx];
+		if (!sort_layout.constant_size[col_idx]) {
+			break;
+		}
+	}
+
+	// Sample the keys of every sorted block, proportional to its size
+	static constexpr idx_t SAMPLES_PER_RANGE = 8;
+	vector<data_t> samples;
+	for (auto &sb : sorted_blocks) {
+		const auto count = sb->Count();
+		if (count == 0) {
+			continue;
+		}
+		const auto sample_count = MaxValue<idx_t>(count * range_count * SAMPLES_PER_RANGE / total_count, 1);
+		SBScanState scan(buffer_manager, *this);
+		scan.sb = sb.get();
+		for (idx_t sample_idx = 0; sample_idx < sample_count; sample_idx++) {
+			auto sample_ptr = GetRadixPtr(scan, (2 * sample_idx + 1) * count / (2 * sample_count));
+			samples.insert(samples.end(), sample_ptr, sample_ptr + prefix_size);
+		}
+	}
+	const auto sample_count = samples.size() / prefix_size;
+	vector<idx_t> sample_order(sample_count);
+	std::iota(sample_order.begin(), sample_order.end(), 0);
+	std::sort(sample_order.begin(), sample_order.end(), [&](const idx_t &lhs, const idx_t &rhs) {
+		return FastMemcmp(samples.data() + lhs * prefix_size, samples.data() + rhs * prefix_size, prefix_size) < 0;
+	});
+
+	// Every range ends at the first row that is not smaller than the next splitter
+	range_bounds.clear();
+	range_bounds.resize(sorted_blocks.size());
+	for (idx_t block_idx = 0; block_idx < sorted_blocks.size(); block_idx++) {
+		auto &sb = *sorted_blocks[block_idx];
+		const auto count = sb.Count();
+		SBScanState scan(buffer_manager, *this);
+		scan.sb = &sb;
+		auto &bounds = range_bounds[block_idx];
+		bounds.push_back(0);
+		for (idx_t r_idx = 1; r_idx < range_count; r_idx++) {
+			auto splitter = samples.data() + sample_order[r_idx * sample_count / range_count] * prefix_size;
+			// The splitters are ordered, so we only have to search after the bound of the previous range
+			idx_t lower = bounds.back();
+			idx_t upper = count;
+			while (lower < upper) {
+				const auto middle = lower + (upper - lower) / 2;
+				if (FastMemcmp(GetRadixPtr(scan, middle), splitter, prefix_size) < 0) {
+					lower = middle + 1;
+				} else {
+					upper = middle;
+				}
+			}
+			bounds.push_back(lower);
+		}
+		bounds.push_back(count);
+	}
+
+	// Skewed keys (e.g., many duplicates) make for unbalanced ranges, which are better merged in rounds
+	idx_t max_range_count = 0;
+	for (idx_t r_idx = 0; r_idx < range_count; r_idx++) {
+		idx_t range_row_count = 0;
+		for (auto &bounds : range_bounds) {
+			range_row_count += bounds[r_idx + 1] - bounds[r_idx];
+		}
+		max_range_count = MaxValue(max_range_count, range_row_count);
+	}
+	if (max_range_count > 2 * total_count / range_count + STANDARD_VECTOR_SIZE) {
+		range_bounds.clear();
+		return false;
+	}
+
+	// Init range merge indices
+	range_merge = true;
+	range_idx = 0;
+	num_ranges = range_count;
+	// Allocate room for merge results
+	sorted_blocks_temp.resize(num_ranges);
+	return true;
+}
+
 void GlobalSortState::CompleteMergeRound(bool keep_radix_data) {
 	sorted_blocks.clear();
-	for (auto &sorted_block_vector : sorted_blocks_temp) {
+	if (range_merge) {
+		// The key ranges are ordered, so the merged ranges are appended into a single block
+		vector<unique_ptr<SortedBlock>> range_blocks;
+		for (auto &sorted_block_vector : sorted_blocks_temp) {
+			for (auto &sb : sorted_block_vector) {
+				range_blocks.push_back(std::move(sb));
+			}
+		}
 		sorted_blocks.push_back(make_uniq<SortedBlock>(buffer_manager, *this));
-		sorted_blocks.back()->AppendSortedBlocks(sorted_block_vector);
+		sorted_blocks.back()->AppendSortedBlocks(range_blocks);
+		range_bounds.clear();
+		range_merge = false;
+	} else {
+		for (auto &sorted_block_vector : sorted_blocks_temp) {
+			sorted_blocks.push_back(make_uniq<SortedBlock>(buffer_manager, *this));
+			sorted_blocks.back()->AppendSortedBlocks(sorted_block_vector);
+		}
 	}
 	sorted_blocks_temp.clear();
 	if (odd_one_out) {
@@ -24,9 +24,8 @@ idx_t SortedData::Count() {
 	return count;
 }
 
-void SortedData::CreateBlock() {
-	auto capacity =
-	    MaxValue(((idx_t)Storage::BLOCK_SIZE + layout.GetRowWidth() - 1) / layout.GetRowWidth(), state.block_capacity);
+void SortedData::CreateBlock(idx_t capacity) {
+	capacity = MaxValue(((idx_t)Storage::BLOCK_SIZE + layout.GetRowWidth() - 1) / layout.GetRowWidth(), capacity);
 	data_blocks.push_back(make_uniq<RowDataBlock>(buffer_manager, capacity, layout.GetRowWidth()));
 	if (!layout.AllConstant() && state.external) {
 		heap_blocks.push_back(make_uniq<RowDataBlock>(buffer_manager, (idx_t)Storage::BLOCK_SIZE, 1));
@@ -94,17 +93,16 @@ idx_t SortedBlock::Count() const {
 	return count;
 }
 
-void SortedBlock::InitializeWrite() {
-	CreateBlock();
+void SortedBlock::InitializeWrite(idx_t capacity) {
+	CreateBlock(capacity);
 	if (!sort_layout.all_constant) {
-		blob_sorting_data->CreateBlock();
+		blob_sorting_data->CreateBlock(capacity);
 	}
-	payload_data->CreateBlock();
+	payload_data->CreateBlock(capacity);
 }
 
-void SortedBlock::CreateBlock() {
-	auto capacity = MaxValue(((idx_t)Storage::BLOCK_SIZE + sort_layout.entry_size - 1) / sort_layout.entry_size,
-	                         state.block_capacity);
+void SortedBlock::CreateBlock(idx_t capacity) {
+	capacity = MaxValue(((idx_t)Storage::BLOCK_SIZE + sort_layout.entry_size - 1) / sort_layout.entry_size, capacity);
 	radix_sorting_data.push_back(make_uniq<RowDataBlock>(buffer_manager, capacity, sort_layout.entry_size));
 }
 
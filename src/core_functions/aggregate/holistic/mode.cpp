@@ -50,13 +50,18 @@ struct ModeState {
 		idx_t first_row;
 	};
 	using Counts = unordered_map<KEY_TYPE, ModeAttr>;
+	//! Windowed counts are keyed by the first row of the partition with the same value
+	using RowCounts = unordered_map<idx_t, ModeAttr>;
 
 	ModeState() {
 	}
 
 	SubFrames prevs;
 	Counts *frequency_map = nullptr;
-	KEY_TYPE *mode = nullptr;
+	RowCounts *window_map = nullptr;
+	//! The first row of the partition with an equal value, shared by all the frames of the partition
+	vector<idx_t> *first_rows = nullptr;
+	idx_t mode = 0;
 	size_t nonzero = 0;
 	bool valid = false;
 	size_t count = 0;
@@ -65,21 +70,24 @@ struct ModeState {
 		if (frequency_map) {
 			delete frequency_map;
 		}
-		if (mode) {
-			delete mode;
+		if (window_map) {
+			delete window_map;
+		}
+		if (first_rows) {
+			delete first_rows;
 		}
 	}
 
 	void Reset() {
-		Counts empty;
-		frequency_map->swap(empty);
+		RowCounts empty;
+		window_map->swap(empty);
 		nonzero = 0;
 		count = 0;
 		valid = false;
 	}
 
-	void ModeAdd(const KEY_TYPE &key, idx_t row) {
-		auto &attr = (*frequency_map)[key];
+	void ModeAdd(idx_t key, idx_t row) {
+		auto &attr = (*window_map)[key];
 		auto new_count = (attr.count += 1);
 		if (new_count == 1) {
 			++nonzero;
@@ -90,29 +98,26 @@ struct ModeState {
 		if (new_count > count) {
 			valid = true;
 			count = new_count;
-			if (mode) {
-				*mode = key;
-			} else {
-				mode = new KEY_TYPE(key);
-			}
+			mode = key;
 		}
 	}
 
-	void ModeRm(const KEY_TYPE &key, idx_t frame) {
-		auto &attr = (*frequency_map)[key];
+	void ModeRm(idx_t key, idx_t frame) {
+		auto &attr = (*window_map)[key];
 		auto old_count = attr.count;
 		nonzero -= int(old_count == 1);
 
 		attr.count -= 1;
-		if (count == old_count && key == *mode) {
+		if (count == old_count && key == mode) {
 			valid = false;
 		}
 	}
 
-	typename Counts::const_iterator Scan() const {
+	template <class COUNTS>
+	static typename COUNTS::const_iterator Scan(const COUNTS &counts) {
 		//! Initialize control variables to first variable of the frequency map
-		auto highest_frequency = frequency_map->begin();
-		for (auto i = highest_frequency; i != frequency_map->end(); ++i) {
+		auto highest_frequency = counts.begin();
+		for (auto i = highest_frequency; i != counts.end(); ++i) {
 			// Tie break with the lowest insert position
 			if (i->second.count > highest_frequency->second.count ||
 			    (i->second.count == highest_frequency->second.count &&
@@ -193,7 +198,7 @@ struct ModeFunction {
 			finalize_data.ReturnNull();
 			return;
 		}
-		auto highest_frequency = state.Scan();
+		auto highest_frequency = STATE::Scan(*state.frequency_map);
 		if (highest_frequency != state.frequency_map->end()) {
 			target = ASSIGN_OP::template Assign<T, T>(finalize_data.result, highest_frequency->first);
 		} else {
@@ -212,14 +217,35 @@ struct ModeFunction {
 		state.count += count;
 	}
 
-	template <typename STATE, typename INPUT_TYPE>
+	template <class STATE, class INPUT_TYPE>
+	static void WindowInit(AggregateInputData &aggr_input_data, const WindowPartitionInput &partition,
+	                       data_ptr_t g_state) {
+		D_ASSERT(partition.input_count == 1);
+
+		//	Hash the values of the partition once, so the frames only have to count row numbers
+		const auto data = FlatVector::GetData<const INPUT_TYPE>(partition.inputs[0]);
+		ModeIncluded included(partition.filter_mask, FlatVector::Validity(partition.inputs[0]));
+
+		auto &state = *reinterpret_cast<STATE *>(g_state);
+		state.first_rows = new vector<idx_t>(partition.count);
+		auto &first_rows = *state.first_rows;
+
+		unordered_map<KEY_TYPE, idx_t> firsts;
+		for (idx_t i = 0; i < partition.count; ++i) {
+			if (included(i)) {
+				first_rows[i] = firsts.emplace(KEY_TYPE(data[i]), i).first->second;
+			}
+		}
+	}
+
+	template <typename STATE>
 	struct UpdateWindowState {
 		STATE &state;
-		const INPUT_TYPE *data;
+		const vector<idx_t> &first_rows;
 		ModeIncluded &included;
 
-		inline UpdateWindowState(STATE &state, const INPUT_TYPE *data, ModeIncluded &included)
-		    : state(state), data(data), included(included) {
+		inline UpdateWindowState(STATE &state, const vector<idx_t> &first_rows, ModeIncluded &included)
+		    : state(state), first_rows(first_rows), included(included) {
 		}
 
 		inline void Neither(idx_t begin, idx_t end) {
@@ -228,7 +254,7 @@ struct ModeFunction {
 		inline void Left(idx_t begin, idx_t end) {
 			for (; begin < end; ++begin) {
 				if (included(begin)) {
-					state.ModeRm(KEY_TYPE(data[begin]), begin);
+					state.ModeRm(first_rows[begin], begin);
 				}
 			}
 		}
@@ -236,7 +262,7 @@ struct ModeFunction {
 		inline void Right(idx_t begin, idx_t end) {
 			for (; begin < end; ++begin) {
 				if (included(begin)) {
-					state.ModeAdd(KEY_TYPE(data[begin]), begin);
+					state.ModeAdd(first_rows[begin], begin);
 				}
 			}
 		}
@@ -258,39 +284,42 @@ struct ModeFunction {
 
 		ModeIncluded included(fmask, dmask);
 
-		if (!state.frequency_map) {
-			state.frequency_map = new typename STATE::Counts;
+		D_ASSERT(gstate && gstate->first_rows);
+		const auto &first_rows = *gstate->first_rows;
+
+		if (!state.window_map) {
+			state.window_map = new typename STATE::RowCounts;
 		}
 		const double tau = .25;
-		if (state.nonzero <= tau * state.frequency_map->size() || prevs.back().end <= frames.front().start ||
+		if (state.nonzero <= tau * state.window_map->size() || prevs.back().end <= frames.front().start ||
 		    frames.back().end <= prevs.front().start) {
 			state.Reset();
 			// for f ∈ F do
 			for (const auto &frame : frames) {
 				for (auto i = frame.start; i < frame.end; ++i) {
 					if (included(i)) {
-						state.ModeAdd(KEY_TYPE(data[i]), i);
+						state.ModeAdd(first_rows[i], i);
 					}
 				}
 			}
 		} else {
-			using Updater = UpdateWindowState<STATE, INPUT_TYPE>;
-			Updater updater(state, data, included);
+			using Updater = UpdateWindowState<STATE>;
+			Updater updater(state, first_rows, included);
 			AggregateExecutor::IntersectFrames(prevs, frames, updater);
 		}
 
 		if (!state.valid) {
 			// Rescan
-			auto highest_frequency = state.Scan();
-			if (highest_frequency != state.frequency_map->end()) {
-				*(state.mode) = highest_frequency->first;
+			auto highest_frequency = STATE::Scan(*state.window_map);
+			if (highest_frequency != state.window_map->end()) {
+				state.mode = highest_frequency->first;
 				state.count = highest_frequency->second.count;
 				state.valid = (state.count > 0);
 			}
 		}
 
 		if (state.valid) {
-			rdata[rid] = ASSIGN_OP::template Assign<INPUT_TYPE, RESULT_TYPE>(result, *state.mode);
+			rdata[rid] = ASSIGN_OP::template Assign<INPUT_TYPE, RESULT_TYPE>(result, data[state.mode]);
 		} else {
 			rmask.Set(rid, false);
 		}
@@ -314,6 +343,7 @@ AggregateFunction GetTypedModeFunction(const LogicalType &type) {
 	using OP = ModeFunction<KEY_TYPE, ASSIGN_OP>;
 	auto func = AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, INPUT_TYPE, OP>(type, type);
 	func.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, INPUT_TYPE, OP>;
+	func.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
 	return func;
 }
 
@@ -12,7 +12,6 @@
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 
-#include "SkipList.h"
 
 #include <algorithm>
 #include <numeric>
@@ -609,6 +608,19 @@ struct QuantileSortTree : public MergeSortTree<IDX, IDX> {
 		return BaseTree::NthElement(BaseTree::SelectNth(frames, n));
 	}
 
+	//! The number of values in the frames. The top level holds the row numbers of all the values in order,
+	//! so this does not have to scan the frames for NULLs or filtered rows.
+	idx_t FrameSize(const SubFrames &frames) const {
+		const auto &rows = BaseTree::tree.back().first;
+		idx_t n = 0;
+		for (const auto &frame : frames) {
+			const auto lower = std::lower_bound(rows.begin(), rows.end(), frame.start);
+			const auto upper = std::lower_bound(lower, rows.end(), frame.end);
+			n += idx_t(upper - lower);
+		}
+		return n;
+	}
+
 	template <typename INPUT_TYPE, typename RESULT_TYPE, bool DISCRETE>
 	RESULT_TYPE WindowScalar(const INPUT_TYPE *data, const SubFrames &frames, const idx_t n, Vector &result,
 	                         const QuantileValue &q) const {
@@ -663,13 +675,6 @@ struct QuantileSortTree : public MergeSortTree<IDX, IDX> {
 	}
 };
 
-template <class T>
-struct PointerLess {
-	inline bool operator()(const T &lhi, const T &rhi) const {
-		return *lhi < *rhi;
-	}
-};
-
 template <typename INPUT_TYPE, typename SAVE_TYPE>
 struct QuantileState {
 	using SaveType = SAVE_TYPE;
@@ -678,20 +683,14 @@ struct QuantileState {
 	// Regular aggregation
 	vector<SaveType> v;
 
-	// Windowed Quantile merge sort trees
+	// Windowed Quantile merge sort trees, shared by all the frames of a partition
 	using QuantileSortTree32 = QuantileSortTree<uint32_t>;
 	using QuantileSortTree64 = QuantileSortTree<uint64_t>;
 	unique_ptr<QuantileSortTree32> qst32;
 	unique_ptr<QuantileSortTree64> qst64;
 
-	// Windowed Quantile skip lists
-	using PointerType = const InputType *;
-	using SkipListType = duckdb_skiplistlib::skip_list::HeadNode<PointerType, PointerLess<PointerType>>;
-	SubFrames prevs;
-	unique_ptr<SkipListType> s;
-	mutable vector<PointerType> dest;
-
 	// Windowed MAD indirection
+	SubFrames prevs;
 	idx_t count;
 	vector<idx_t> m;
 
@@ -708,68 +707,20 @@ struct QuantileState {
 		}
 	}
 
-	inline SkipListType &GetSkipList(bool reset = false) {
-		if (reset || !s) {
-			s.reset();
-			s = make_uniq<SkipListType>();
-		}
-		return *s;
+	bool HasTrees() const {
+		return qst32 || qst64;
 	}
 
-	struct SkipListUpdater {
-		SkipListType &skip;
-		const INPUT_TYPE *data;
-		const QuantileIncluded &included;
-
-		inline SkipListUpdater(SkipListType &skip, const INPUT_TYPE *data, const QuantileIncluded &included)
-		    : skip(skip), data(data), included(included) {
-		}
-
-		inline void Neither(idx_t begin, idx_t end) {
-		}
-
-		inline void Left(idx_t begin, idx_t end) {
-			for (; begin < end; ++begin) {
-				if (included(begin)) {
-					skip.remove(data + begin);
-				}
-			}
-		}
-
-		inline void Right(idx_t begin, idx_t end) {
-			for (; begin < end; ++begin) {
-				if (included(begin)) {
-					skip.insert(data + begin);
-				}
-			}
-		}
-
-		inline void Both(idx_t begin, idx_t end) {
-		}
-	};
-
-	void UpdateSkip(const INPUT_TYPE *data, const SubFrames &frames, const QuantileIncluded &included) {
-		//	No overlap, or no data
-		if (!s || prevs.back().end <= frames.front().start || frames.back().end <= prevs.front().start) {
-			auto &skip = GetSkipList(true);
-			for (const auto &frame : frames) {
-				for (auto i = frame.start; i < frame.end; ++i) {
-					if (included(i)) {
-						skip.insert(data + i);
-					}
-				}
-			}
+	idx_t FrameSize(const SubFrames &frames) const {
+		if (qst32) {
+			return qst32->FrameSize(frames);
+		} else if (qst64) {
+			return qst64->FrameSize(frames);
 		} else {
-			auto &skip = GetSkipList();
-			SkipListUpdater updater(skip, data, included);
-			AggregateExecutor::IntersectFrames(prevs, frames, updater);
+			throw InternalException("No accelerator for windowed QUANTILE");
 		}
 	}
 
-	bool HasTrees() const {
-		return qst32 || qst64;
-	}
-
 	template <typename RESULT_TYPE, bool DISCRETE>
 	RESULT_TYPE WindowScalar(const INPUT_TYPE *data, const SubFrames &frames, const idx_t n, Vector &result,
 	                         const QuantileValue &q) const {
@@ -778,15 +729,6 @@ struct QuantileState {
 			return qst32->WindowScalar<INPUT_TYPE, RESULT_TYPE, DISCRETE>(data, frames, n, result, q);
 		} else if (qst64) {
 			return qst64->WindowScalar<INPUT_TYPE, RESULT_TYPE, DISCRETE>(data, frames, n, result, q);
-		} else if (s) {
-			// Find the position(s) needed
-			try {
-				Interpolator<DISCRETE> interp(q, s->size(), false);
-				s->at(interp.FRN, interp.CRN - interp.FRN + 1, dest);
-				return interp.template Extract<INPUT_TYPE, RESULT_TYPE>(dest.data(), result);
-			} catch (const duckdb_skiplistlib::skip_list::IndexError &idx_err) {
-				throw InternalException(idx_err.message());
-			}
 		} else {
 			throw InternalException("No accelerator for scalar QUANTILE");
 		}
@@ -858,19 +800,9 @@ struct QuantileOperation {
 		auto inputs = partition.inputs;
 		const auto count = partition.count;
 		const auto &filter_mask = partition.filter_mask;
-		const auto &stats = partition.stats;
-
-		//	If frames overlap significantly, then use local skip lists.
-		if (stats[0].end <= stats[1].begin) {
-			//	Frames can overlap
-			const auto overlap = double(stats[1].begin - stats[0].end);
-			const auto cover = double(stats[1].end - stats[0].begin);
-			const auto ratio = overlap / cover;
-			if (ratio > .75) {
-				return;
-			}
-		}
 
+		//	Build a single tree for all the frames of the partition,
+		//	instead of maintaining a sorted frame in every thread.
 		const auto data = FlatVector::GetData<const INPUT_TYPE>(inputs[0]);
 		const auto &data_mask = FlatVector::Validity(inputs[0]);
 
@@ -884,25 +816,6 @@ struct QuantileOperation {
 			                                                                 filter_mask, count);
 		}
 	}
-
-	static idx_t FrameSize(const QuantileIncluded &included, const SubFrames &frames) {
-		//	Count the number of valid values
-		idx_t n = 0;
-		if (included.AllValid()) {
-			for (const auto &frame : frames) {
-				n += frame.end - frame.start;
-			}
-		} else {
-			//	NULLs or FILTERed values,
-			for (const auto &frame : frames) {
-				for (auto i = frame.start; i < frame.end; ++i) {
-					n += included(i);
-				}
-			}
-		}
-
-		return n;
-	}
 };
 
 template <class STATE, class INPUT_TYPE, class RESULT_TYPE, class OP>
@@ -935,8 +848,8 @@ struct QuantileScalarOperation : public QuantileOperation {
 	static void Window(const INPUT_TYPE *data, const ValidityMask &fmask, const ValidityMask &dmask,
 	                   AggregateInputData &aggr_input_data, STATE &state, const SubFrames &frames, Vector &result,
 	                   idx_t ridx, const STATE *gstate) {
-		QuantileIncluded included(fmask, dmask);
-		const auto n = FrameSize(included, frames);
+		D_ASSERT(gstate);
+		const auto n = gstate->FrameSize(frames);
 
 		D_ASSERT(aggr_input_data.bind_data);
 		auto &bind_data = aggr_input_data.bind_data->Cast<QuantileBindData>();
@@ -950,18 +863,7 @@ struct QuantileScalarOperation : public QuantileOperation {
 		}
 
 		const auto &quantile = bind_data.quantiles[0];
-		if (gstate && gstate->HasTrees()) {
-			rdata[ridx] = gstate->template WindowScalar<RESULT_TYPE, DISCRETE>(data, frames, n, result, quantile);
-		} else {
-			//	Update the skip list
-			state.UpdateSkip(data, frames, included);
-
-			// Find the position(s) needed
-			rdata[ridx] = state.template WindowScalar<RESULT_TYPE, DISCRETE>(data, frames, n, result, quantile);
-
-			//	Save the previous state for next time
-			state.prevs = frames;
-		}
+		rdata[ridx] = gstate->template WindowScalar<RESULT_TYPE, DISCRETE>(data, frames, n, result, quantile);
 	}
 };
 
@@ -1066,8 +968,8 @@ struct QuantileListOperation : public QuantileOperation {
 		D_ASSERT(aggr_input_data.bind_data);
 		auto &bind_data = aggr_input_data.bind_data->Cast<QuantileBindData>();
 
-		QuantileIncluded included(fmask, dmask);
-		const auto n = FrameSize(included, frames);
+		D_ASSERT(gstate);
+		const auto n = gstate->FrameSize(frames);
 
 		// Result is a constant LIST<RESULT_TYPE> with a fixed length
 		if (!n) {
@@ -1076,14 +978,7 @@ struct QuantileListOperation : public QuantileOperation {
 			return;
 		}
 
-		if (gstate && gstate->HasTrees()) {
-			gstate->template WindowList<CHILD_TYPE, DISCRETE>(data, frames, n, list, lidx, bind_data);
-		} else {
-			//
-			state.UpdateSkip(data, frames, included);
-			state.template WindowList<CHILD_TYPE, DISCRETE>(data, frames, n, list, lidx, bind_data);
-			state.prevs = frames;
-		}
+		gstate->template WindowList<CHILD_TYPE, DISCRETE>(data, frames, n, list, lidx, bind_data);
 	}
 };
 
@@ -1359,8 +1254,8 @@ struct MedianAbsoluteDeviationOperation : public QuantileOperation {
 	                   idx_t ridx, const STATE *gstate) {
 		auto rdata = FlatVector::GetData<RESULT_TYPE>(result);
 
-		QuantileIncluded included(fmask, dmask);
-		const auto n = FrameSize(included, frames);
+		D_ASSERT(gstate);
+		const auto n = gstate->FrameSize(frames);
 
 		if (!n) {
 			auto &rmask = FlatVector::Validity(result);
@@ -1374,13 +1269,7 @@ struct MedianAbsoluteDeviationOperation : public QuantileOperation {
 
 		D_ASSERT(bind_data.quantiles.size() == 1);
 		const auto &quantile = bind_data.quantiles[0];
-		MEDIAN_TYPE med;
-		if (gstate && gstate->HasTrees()) {
-			med = gstate->template WindowScalar<MEDIAN_TYPE, false>(data, frames, n, result, quantile);
-		} else {
-			state.UpdateSkip(data, frames, included);
-			med = state.template WindowScalar<MEDIAN_TYPE, false>(data, frames, n, result, quantile);
-		}
+		const auto med = gstate->template WindowScalar<MEDIAN_TYPE, false>(data, frames, n, result, quantile);
 
 		//  Lazily initialise frame state
 		state.SetCount(frames.back().end - frames.front().start);
@@ -1392,6 +1281,7 @@ struct MedianAbsoluteDeviationOperation : public QuantileOperation {
 		// It is probably close, however, and so reuse is helpful.
 		auto &prevs = state.prevs;
 		ReuseIndexes(index2, frames, prevs);
+		QuantileIncluded included(fmask, dmask);
 		std::partition(index2, index2 + state.count, included);
 
 		Interpolator<false> interp(quantile, n, false);
@@ -1407,7 +1297,7 @@ struct MedianAbsoluteDeviationOperation : public QuantileOperation {
 		MadIndirect mad_indirect(mad, indirect);
 		rdata[ridx] = interp.template Operation<idx_t, RESULT_TYPE, MadIndirect>(index2, result, mad_indirect);
 
-		//	Prev is used by both skip lists and increments
+		//	Prev is used for reusing the increments
 		prevs = frames;
 	}
 };
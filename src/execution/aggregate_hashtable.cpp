@@ -40,7 +40,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), skip_lookups(false), count(0), capacity(0),
+      aggregate_allocator(make_shared<ArenaAllocator>(allocator)) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -165,6 +166,14 @@ void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
 	radix_bits = radix_bits_p;
 }
 
+void GroupedAggregateHashTable::SetSkipLookups(bool skip_lookups_p) {
+	skip_lookups = skip_lookups_p;
+}
+
+bool GroupedAggregateHashTable::SkipLookups() const {
+	return skip_lookups;
+}
+
 void GroupedAggregateHashTable::Resize(idx_t size) {
 	D_ASSERT(size >= STANDARD_VECTOR_SIZE);
 	D_ASSERT(IsPowerOfTwo(size));
@@ -312,8 +321,8 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	D_ASSERT(addresses_v.GetType() == LogicalType::POINTER);
 	D_ASSERT(state.hash_salts.GetType() == LogicalType::HASH);
 
-	// Need to fit the entire vector, and resize at threshold
-	if (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold()) {
+	// Need to fit the entire vector, and resize at threshold (the pointer table is not used if we skip lookups)
+	if (!skip_lookups && (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold())) {
 		Verify();
 		Resize(capacity * 2);
 	}
@@ -358,6 +367,23 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
 
+	if (skip_lookups) {
+		// Every row becomes a new group, without touching the pointer table
+		const auto group_count = groups.size();
+		partitioned_data->AppendUnified(state.append_state, state.group_chunk, *FlatVector::IncrementalSelectionVector(),
+		                                group_count);
+		RowOperations::InitializeStates(layout, chunk_state.row_locations, *FlatVector::IncrementalSelectionVector(),
+		                                group_count);
+
+		const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+		const auto &row_sel = state.append_state.reverse_partition_sel;
+		for (idx_t index = 0; index < group_count; index++) {
+			addresses[index] = row_locations[row_sel.get_index(index)];
+			new_groups_out.set_index(index, index);
+		}
+		return group_count;
+	}
+
 	idx_t new_group_count = 0;
 	idx_t remaining_entries = groups.size();
 	while (remaining_entries > 0) {
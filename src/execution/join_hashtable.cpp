@@ -18,7 +18,9 @@ JoinHashTable::JoinHashTable(BufferManager &buffer_manager_p, const vector<JoinC
                              vector<LogicalType> btypes, JoinType type_p)
     : buffer_manager(buffer_manager_p), conditions(conditions_p), build_types(std::move(btypes)), entry_size(0),
       tuple_size(0), vfound(Value::BOOLEAN(false)), join_type(type_p), finalized(false), has_null(false),
-      external(false), radix_bits(4), partition_start(0), partition_end(0) {
+      external(false), prefer_partitioned(false), partitioned_in_memory(false), radix_bits(4), partition_start(0),
+      partition_end(0), sub_radix_bits(0), sub_partition_start(0), sub_partition_end(0), sub_partitioning_failed(false),
+      partial_continued(false), partial_remaining(false) {
 
 	for (auto &condition : conditions) {
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
@@ -86,33 +88,27 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	sink_collection->Combine(*other.sink_collection);
 }
 
-void JoinHashTable::ApplyBitmask(Vector &hashes, idx_t count) {
-	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		D_ASSERT(!ConstantVector::IsNull(hashes));
-		auto indices = ConstantVector::GetData<hash_t>(hashes);
-		*indices = *indices & bitmask;
-	} else {
-		hashes.Flatten(count);
-		auto indices = FlatVector::GetData<hash_t>(hashes);
-		for (idx_t i = 0; i < count; i++) {
-			indices[i] &= bitmask;
-		}
-	}
-}
-
-void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
+void JoinHashTable::GetRowPointers(Vector &hashes, const SelectionVector &sel, idx_t &count, Vector &pointers,
+                                   SelectionVector &match_sel) {
 	UnifiedVectorFormat hdata;
 	hashes.ToUnifiedFormat(count, hdata);
 
 	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
-	auto result_data = FlatVector::GetData<data_ptr_t *>(pointers);
-	auto main_ht = reinterpret_cast<data_ptr_t *>(hash_map.get());
+	auto result_data = FlatVector::GetData<data_ptr_t>(pointers);
+	auto entries = reinterpret_cast<const hash_t *>(hash_map.get());
+	// we load all entries in one tight loop, so that the (likely) cache misses can be resolved in parallel
+	// entries whose salt does not contain the salt of the hash cannot contain a match: we skip their chain entirely
+	idx_t match_count = 0;
 	for (idx_t i = 0; i < count; i++) {
-		auto rindex = sel.get_index(i);
-		auto hindex = hdata.sel->get_index(rindex);
-		auto hash = hash_data[hindex];
-		result_data[rindex] = main_ht + (hash & bitmask);
+		const auto rindex = sel.get_index(i);
+		const auto hash = hash_data[hdata.sel->get_index(rindex)];
+		const auto entry = entries[hash & bitmask];
+		result_data[rindex] = GetPointer(entry);
+		if (entry & ExtractSalt(hash)) {
+			match_sel.set_index(match_count++, rindex);
+		}
 	}
+	count = match_count;
 }
 
 void JoinHashTable::Hash(DataChunk &keys, const SelectionVector &sel, idx_t count, Vector &hashes) {
@@ -244,22 +240,29 @@ idx_t JoinHashTable::PrepareKeys(DataChunk &keys, vector<TupleDataVectorFormat>
 }
 
 template <bool PARALLEL>
-static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t indices[], const idx_t count,
-                                    const data_ptr_t key_locations[], const idx_t pointer_offset) {
+static inline void InsertHashesLoop(atomic<hash_t> entries[], const hash_t hashes[], const idx_t count,
+                                    const data_ptr_t key_locations[], const idx_t pointer_offset, const uint64_t bitmask) {
 	for (idx_t i = 0; i < count; i++) {
-		const auto index = indices[i];
+		const auto hash = hashes[i];
+		const auto index = hash & bitmask;
+		const auto salt = JoinHashTable::ExtractSalt(hash);
+		const auto key_location = static_cast<hash_t>(reinterpret_cast<uintptr_t>(key_locations[i]));
+		// pointers shouldn't use the upper bits
+		D_ASSERT((key_location & JoinHashTable::SALT_MASK) == 0);
 		if (PARALLEL) {
-			data_ptr_t head;
+			hash_t head;
 			do {
-				head = pointers[index];
-				Store<data_ptr_t>(head, key_locations[i] + pointer_offset);
-			} while (!std::atomic_compare_exchange_weak(&pointers[index], &head, key_locations[i]));
+				head = entries[index];
+				Store<data_ptr_t>(JoinHashTable::GetPointer(head), key_locations[i] + pointer_offset);
+			} while (!std::atomic_compare_exchange_weak(&entries[index], &head,
+			                                            key_location | (head & JoinHashTable::SALT_MASK) | salt));
 		} else {
+			const hash_t head = entries[index];
 			// set prev in current key to the value (NOTE: this will be nullptr if there is none)
-			Store<data_ptr_t>(pointers[index], key_locations[i] + pointer_offset);
+			Store<data_ptr_t>(JoinHashTable::GetPointer(head), key_locations[i] + pointer_offset);
 
-			// set pointer to current tuple
-			pointers[index] = key_locations[i];
+			// set pointer to current tuple, and add its salt to the salt of the entry
+			entries[index] = key_location | (head & JoinHashTable::SALT_MASK) | salt;
 		}
 	}
 }
@@ -267,19 +270,16 @@ static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t
 void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel) {
 	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
 
-	// use bitmask to get position in array
-	ApplyBitmask(hashes, count);
-
 	hashes.Flatten(count);
 	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
 
-	auto pointers = reinterpret_cast<atomic<data_ptr_t> *>(hash_map.get());
-	auto indices = FlatVector::GetData<hash_t>(hashes);
+	auto entries = reinterpret_cast<atomic<hash_t> *>(hash_map.get());
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
 
 	if (parallel) {
-		InsertHashesLoop<true>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<true>(entries, hash_data, count, key_locations, pointer_offset, bitmask);
 	} else {
-		InsertHashesLoop<false>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<false>(entries, hash_data, count, key_locations, pointer_offset, bitmask);
 	}
 }
 
@@ -287,24 +287,16 @@ void JoinHashTable::InitializePointerTable() {
 	idx_t capacity = PointerTableCapacity(Count());
 	D_ASSERT(IsPowerOfTwo(capacity));
 
-	if (hash_map.get()) {
-		// There is already a hash map
-		auto current_capacity = hash_map.GetSize() / sizeof(data_ptr_t);
-		if (capacity > current_capacity) {
-			// Need more space
-			hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(data_ptr_t));
-		} else {
-			// Just use the current hash map
-			capacity = current_capacity;
-		}
-	} else {
-		// Allocate a hash map
-		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(data_ptr_t));
+	if (hash_map.GetSize() != capacity * sizeof(hash_t)) {
+		// Allocate a hash map. If there already is one that is too large, e.g., because the previous external round
+		// had more data, we also re-allocate it, so that it does not take up memory that the next round may need
+		hash_map.Reset();
+		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(hash_t));
 	}
-	D_ASSERT(hash_map.GetSize() == capacity * sizeof(data_ptr_t));
+	D_ASSERT(hash_map.GetSize() == capacity * sizeof(hash_t));
 
 	// initialize HT with all-zero entries
-	std::fill_n(reinterpret_cast<data_ptr_t *>(hash_map.get()), capacity, nullptr);
+	std::fill_n(reinterpret_cast<hash_t *>(hash_map.get()), capacity, hash_t(0));
 
 	bitmask = capacity - 1;
 }
@@ -355,20 +347,17 @@ unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, TupleDataChunkSt
 		return ss;
 	}
 
+	// initialize the pointers of the scan structure, and the selection vector linking to only non-empty entries
 	if (precomputed_hashes) {
-		ApplyBitmask(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
+		GetRowPointers(*precomputed_hashes, *current_sel, ss->count, ss->pointers, ss->sel_vector);
 	} else {
 		// hash all the keys
 		Vector hashes(LogicalType::HASH);
 		Hash(keys, *current_sel, ss->count, hashes);
 
-		// now initialize the pointers of the scan structure based on the hashes
-		ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+		GetRowPointers(hashes, *current_sel, ss->count, ss->pointers, ss->sel_vector);
 	}
 
-	// create the selection vector linking to only non-empty entries
-	ss->InitializeSelectionVector(current_sel);
-
 	return ss;
 }
 
@@ -465,20 +454,6 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, idx_t sel_count)
 	this->count = new_count;
 }
 
-void ScanStructure::InitializeSelectionVector(const SelectionVector *&current_sel) {
-	idx_t non_empty_count = 0;
-	auto ptrs = FlatVector::GetData<data_ptr_t>(pointers);
-	auto cnt = count;
-	for (idx_t i = 0; i < cnt; i++) {
-		const auto idx = current_sel->get_index(i);
-		ptrs[idx] = Load<data_ptr_t>(ptrs[idx]);
-		if (ptrs[idx]) {
-			sel_vector.set_index(non_empty_count++, idx);
-		}
-	}
-	count = non_empty_count;
-}
-
 void ScanStructure::AdvancePointers() {
 	AdvancePointers(this->sel_vector, this->count);
 }
@@ -895,6 +870,13 @@ bool JoinHashTable::RequiresExternalJoin(ClientConfig &config, vector<unique_ptr
 	} else {
 		auto ht_size = data_size + PointerTableSize(total_count);
 		external = ht_size > max_ht_size;
+		if (!external && (config.force_partitioned_hash_join || (prefer_partitioned && ht_size > PARTITIONED_HT_SIZE))) {
+			// The HT fits in memory, but not in the CPU caches: build and probe it in rounds of cache-sized partitions
+			// If forced, we do at least a few rounds to test all code paths
+			max_ht_size = MinValue<idx_t>(PARTITIONED_HT_SIZE, MaxValue<idx_t>(ht_size / 4, 1));
+			external = true;
+			partitioned_in_memory = true;
+		}
 	}
 	return external;
 }
@@ -974,41 +956,225 @@ void JoinHashTable::Reset() {
 	finalized = false;
 }
 
-bool JoinHashTable::PrepareExternalFinalize() {
-	if (finalized) {
-		Reset();
+bool JoinHashTable::CanBuildPartially() const {
+	switch (join_type) {
+	case JoinType::INNER:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::RIGHT_ANTI:
+		return true;
+	default:
+		return false;
 	}
+}
 
-	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
-	if (partition_end == num_partitions) {
-		return false;
+bool JoinHashTable::FitsInMemory(TupleDataCollection &partition) const {
+	return partition.SizeInBytes() + PointerTableSize(partition.Count()) <= max_ht_size;
+}
+
+idx_t JoinHashTable::SubPartitionRadixBits(TupleDataCollection &partition, idx_t current_radix_bits) const {
+	// Same as in RequiresPartitioning: aim for an estimated sub-partition size of max_ht_size / 4
+	const auto max_added_bits = RadixPartitioning::MAX_RADIX_BITS - current_radix_bits;
+	idx_t added_bits = 1;
+	for (; added_bits < max_added_bits; added_bits++) {
+		double partition_multiplier = RadixPartitioning::NumberOfPartitions(added_bits);
+		auto new_estimated_count = double(partition.Count()) / partition_multiplier;
+		auto new_estimated_size = double(partition.SizeInBytes()) / partition_multiplier;
+		auto new_estimated_ht_size = new_estimated_size + PointerTableSize(new_estimated_count);
+		if (new_estimated_ht_size <= double(max_ht_size) / 4) {
+			break;
+		}
 	}
+	return current_radix_bits + added_bits;
+}
 
-	// Start where we left off
-	auto &partitions = sink_collection->GetPartitions();
-	partition_start = partition_end;
+void JoinHashTable::SubPartition(TupleDataCollection &partition) {
+	D_ASSERT(!sub_partitions);
+	sub_radix_bits = SubPartitionRadixBits(partition, radix_bits);
+	sub_partitions =
+	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, sub_radix_bits, layout.ColumnCount() - 1);
 
-	// Determine how many partitions we can do next (at least one)
+	PartitionedTupleDataAppendState append_state;
+	sub_partitions->InitializeAppendState(append_state);
+	TupleDataChunkIterator iterator(partition, TupleDataPinProperties::DESTROY_AFTER_DONE, true);
+	auto &chunk_state = iterator.GetChunkState();
+	do {
+		sub_partitions->Append(append_state, chunk_state, iterator.GetCurrentChunkCount());
+	} while (iterator.Next());
+	sub_partitions->FlushAppendState(append_state);
+	partition.Reset();
+
+	// The radix bits are the upper bits of the hash, so the sub-partitions of partition p at "radix_bits" are
+	// p << added_bits up to (p + 1) << added_bits at "sub_radix_bits"
+	sub_partition_end = partition_start << (sub_radix_bits - radix_bits);
+	sub_partitioning_failed = false;
+}
+
+bool JoinHashTable::RepartitionSubPartitions() {
+	auto &partition = *sub_partitions->GetPartitions()[sub_partition_start];
+	const auto partition_count = partition.Count();
+	const auto new_sub_radix_bits = SubPartitionRadixBits(partition, sub_radix_bits);
+	const auto added_bits = new_sub_radix_bits - sub_radix_bits;
+
+	// The sub-partitions that we have already done are empty, so this only moves the remaining data
+	auto new_sub_partitions =
+	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, new_sub_radix_bits, layout.ColumnCount() - 1);
+	sub_partitions->Repartition(*new_sub_partitions);
+	sub_partitions = std::move(new_sub_partitions);
+	sub_radix_bits = new_sub_radix_bits;
+	sub_partition_start <<= added_bits;
+
+	auto &partitions = sub_partitions->GetPartitions();
+	idx_t max_partition_count = 0;
+	for (idx_t partition_idx = sub_partition_start;
+	     partition_idx < sub_partition_start + RadixPartitioning::NumberOfPartitions(added_bits); partition_idx++) {
+		max_partition_count = MaxValue<idx_t>(max_partition_count, partitions[partition_idx]->Count());
+	}
+	return max_partition_count < partition_count;
+}
+
+void JoinHashTable::BuildPartially(TupleDataCollection &partition) {
+	if (!partial_scan_state) {
+		partial_scan_state = make_uniq<TupleDataScanState>();
+		partition.InitializeScan(*partial_scan_state, TupleDataPinProperties::DESTROY_AFTER_DONE);
+	}
+
+	DataChunk chunk;
+	partition.InitializeScanChunk(*partial_scan_state, chunk);
+	TupleDataAppendState append_state;
+	data_collection->InitializeAppend(append_state);
+
+	// Move rows into the data collection until the HT is full
+	partial_remaining = false;
+	while (partition.Scan(*partial_scan_state, chunk)) {
+		data_collection->Append(append_state, chunk);
+		if (data_collection->SizeInBytes() + PointerTableSize(data_collection->Count()) >= max_ht_size) {
+			partial_remaining = !partition.ScanComplete(*partial_scan_state);
+			break;
+		}
+	}
+	data_collection->FinalizePinState(append_state.pin_state);
+
+	if (!partial_remaining) {
+		partial_scan_state.reset();
+		partition.Reset();
+	}
+}
+
+//! Determines how many of the partitions, starting at partition_start, fit in the HT (at least one)
+static idx_t NextPartitionEnd(vector<unique_ptr<TupleDataCollection>> &partitions, const idx_t partition_start,
+                              const idx_t partition_end, const idx_t max_ht_size) {
 	idx_t count = 0;
 	idx_t data_size = 0;
 	idx_t partition_idx;
-	for (partition_idx = partition_start; partition_idx < num_partitions; partition_idx++) {
+	for (partition_idx = partition_start; partition_idx < partition_end; partition_idx++) {
 		auto incl_count = count + partitions[partition_idx]->Count();
 		auto incl_data_size = data_size + partitions[partition_idx]->SizeInBytes();
-		auto incl_ht_size = incl_data_size + PointerTableSize(incl_count);
+		auto incl_ht_size = incl_data_size + JoinHashTable::PointerTableSize(incl_count);
 		if (count > 0 && incl_ht_size > max_ht_size) {
 			break;
 		}
 		count = incl_count;
 		data_size = incl_data_size;
 	}
-	partition_end = partition_idx;
+	return partition_idx;
+}
+
+bool JoinHashTable::PrepareSubPartitions() {
+	const auto sub_partitions_end = (partition_start + 1) << (sub_radix_bits - radix_bits);
+	if (sub_partition_end == sub_partitions_end) {
+		// Done with all sub-partitions
+		sub_partitions.reset();
+		return false;
+	}
+
+	// Start where we left off
+	sub_partition_start = sub_partition_end;
+
+	// If the next sub-partition does not fit in memory either, we repartition recursively with even more radix bits,
+	// for as long as that splits it up. If it does not, it consists of (almost) a single key, and we build it partially
+	while (!FitsInMemory(*sub_partitions->GetPartitions()[sub_partition_start]) && !sub_partitioning_failed &&
+	       sub_radix_bits < RadixPartitioning::MAX_RADIX_BITS) {
+		sub_partitioning_failed = !RepartitionSubPartitions();
+	}
+	auto &partitions = sub_partitions->GetPartitions();
+	if (!FitsInMemory(*partitions[sub_partition_start]) && CanBuildPartially()) {
+		sub_partition_end = sub_partition_start + 1;
+		BuildPartially(*partitions[sub_partition_start]);
+		return true;
+	}
+
+	sub_partition_end =
+	    NextPartitionEnd(partitions, sub_partition_start, (partition_start + 1) << (sub_radix_bits - radix_bits),
+	                     max_ht_size);
+	for (idx_t partition_idx = sub_partition_start; partition_idx < sub_partition_end; partition_idx++) {
+		data_collection->Combine(*partitions[partition_idx]);
+	}
+	return true;
+}
+
+void JoinHashTable::GetCurrentPartitions(idx_t &current_radix_bits, idx_t &current_start, idx_t &current_end) const {
+	if (sub_partitions) {
+		current_radix_bits = sub_radix_bits;
+		current_start = sub_partition_start;
+		current_end = sub_partition_end;
+	} else {
+		current_radix_bits = radix_bits;
+		current_start = partition_start;
+		current_end = partition_end;
+	}
+}
+
+bool JoinHashTable::PrepareExternalFinalize() {
+	if (finalized) {
+		Reset();
+	}
+
+	if (partial_scan_state) {
+		// Build the next rows of the partition that we are building partially
+		partial_continued = true;
+		auto &partitions = sub_partitions ? sub_partitions->GetPartitions() : sink_collection->GetPartitions();
+		BuildPartially(*partitions[sub_partitions ? sub_partition_start : partition_start]);
+		return true;
+	}
+	partial_continued = false;
+	partial_remaining = false;
+
+	if (sub_partitions && PrepareSubPartitions()) {
+		return true;
+	}
+
+	if (partition_end == RadixPartitioning::NumberOfPartitions(radix_bits)) {
+		return false;
+	}
+
+	// Start where we left off
+	partition_start = partition_end;
+
+	auto &partitions = sink_collection->GetPartitions();
+	if (!partitioned_in_memory && !FitsInMemory(*partitions[partition_start])) {
+		// The next partition does not fit in memory by itself (e.g., because of skew)
+		partition_end = partition_start + 1;
+		if (radix_bits < RadixPartitioning::MAX_RADIX_BITS) {
+			// Split it up into sub-partitions with more radix bits
+			SubPartition(*partitions[partition_start]);
+			PrepareSubPartitions();
+			return true;
+		}
+		if (CanBuildPartially()) {
+			BuildPartially(*partitions[partition_start]);
+			return true;
+		}
+	}
+
+	// Determine how many partitions we can do next (at least one)
+	partition_end = NextPartitionEnd(partitions, partition_start, RadixPartitioning::NumberOfPartitions(radix_bits),
+	                                 max_ht_size);
 
 	// Move the partitions to the main data collection
-	for (partition_idx = partition_start; partition_idx < partition_end; partition_idx++) {
+	for (idx_t partition_idx = partition_start; partition_idx < partition_end; partition_idx++) {
 		data_collection->Combine(*partitions[partition_idx]);
 	}
-	D_ASSERT(Count() == count);
 
 	return true;
 }
@@ -1040,16 +1206,24 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, TupleDat
 	SelectionVector false_sel;
 	true_sel.Initialize();
 	false_sel.Initialize();
+	idx_t current_radix_bits, current_start, current_end;
+	GetCurrentPartitions(current_radix_bits, current_start, current_end);
 	auto true_count = RadixPartitioning::Select(hashes, FlatVector::IncrementalSelectionVector(), keys.size(),
-	                                            radix_bits, partition_end, &true_sel, &false_sel);
+	                                            current_radix_bits, current_end, &true_sel, &false_sel);
 	auto false_count = keys.size() - true_count;
 
 	CreateSpillChunk(spill_chunk, keys, payload, hashes);
 
-	// can't probe these values right now, append to spill
-	spill_chunk.Slice(false_sel, false_count);
-	spill_chunk.Verify();
-	probe_spill.Append(spill_chunk, spill_state);
+	if (partial_remaining) {
+		// the values that we probe now also have to be probed with the next rounds of the current partition
+		spill_chunk.Verify();
+		probe_spill.Append(spill_chunk, spill_state);
+	} else {
+		// can't probe these values right now, append to spill
+		spill_chunk.Slice(false_sel, false_count);
+		spill_chunk.Verify();
+		probe_spill.Append(spill_chunk, spill_state);
+	}
 
 	// slice the stuff we CAN probe right now
 	hashes.Slice(true_sel, true_count);
@@ -1063,20 +1237,17 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, TupleDat
 	}
 
 	// now initialize the pointers of the scan structure based on the hashes
-	ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
-
-	// create the selection vector linking to only non-empty entries
-	ss->InitializeSelectionVector(current_sel);
+	GetRowPointers(hashes, *current_sel, ss->count, ss->pointers, ss->sel_vector);
 
 	return ss;
 }
 
 ProbeSpill::ProbeSpill(JoinHashTable &ht, ClientContext &context, const vector<LogicalType> &probe_types)
-    : ht(ht), context(context), probe_types(probe_types) {
+    : ht(ht), context(context), probe_types(probe_types), retain_spill_collection(false) {
 	auto remaining_count = ht.GetSinkCollection().Count();
 	auto remaining_data_size = ht.GetSinkCollection().SizeInBytes();
 	auto remaining_ht_size = remaining_data_size + ht.PointerTableSize(remaining_count);
-	if (remaining_ht_size <= ht.max_ht_size) {
+	if (remaining_ht_size <= ht.max_ht_size && !ht.sub_partitions && !ht.partial_remaining) {
 		// No need to partition as we will only have one more probe round
 		partitioned = false;
 	} else {
@@ -1147,10 +1318,59 @@ void ProbeSpill::Finalize() {
 	}
 }
 
+void ProbeSpill::GatherSubPartitions(idx_t sub_radix_bits, idx_t sub_partition_start, idx_t sub_partition_end) {
+	global_spill_collection = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), probe_types);
+	ColumnDataAppendState append_state;
+	global_spill_collection->InitializeAppend(append_state);
+
+	// The sub-partitions in the HT are part of one of our partitions, from which we select the rows
+	auto &partitions = global_partitions->GetPartitions();
+	const auto added_bits = sub_radix_bits - ht.radix_bits;
+	auto &partition = partitions[sub_partition_start >> added_bits];
+	D_ASSERT(partition);
+
+	const auto hash_col_idx = probe_types.size() - 1;
+	const auto mask = RadixPartitioning::Mask(sub_radix_bits);
+	const auto shift = RadixPartitioning::Shift(sub_radix_bits);
+	SelectionVector in_range_sel(STANDARD_VECTOR_SIZE);
+	DataChunk sliced_chunk;
+	sliced_chunk.InitializeEmpty(probe_types);
+	for (auto &chunk : partition->Chunks()) {
+		UnifiedVectorFormat hash_data;
+		chunk.data[hash_col_idx].ToUnifiedFormat(chunk.size(), hash_data);
+		auto hashes = UnifiedVectorFormat::GetData<hash_t>(hash_data);
+		idx_t in_range_count = 0;
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			const auto sub_partition_idx = (hashes[hash_data.sel->get_index(i)] & mask) >> shift;
+			if (sub_partition_idx >= sub_partition_start && sub_partition_idx < sub_partition_end) {
+				in_range_sel.set_index(in_range_count++, i);
+			}
+		}
+		if (in_range_count == 0) {
+			continue;
+		}
+		sliced_chunk.Slice(chunk, in_range_sel, in_range_count);
+		global_spill_collection->Append(append_state, sliced_chunk);
+	}
+
+	if (((sub_partition_start >> added_bits) + 1) << added_bits == sub_partition_end) {
+		// This was the last round of the partition
+		partition.reset();
+	}
+}
+
 void ProbeSpill::PrepareNextProbe() {
-	if (partitioned) {
+	idx_t current_radix_bits, current_start, current_end;
+	ht.GetCurrentPartitions(current_radix_bits, current_start, current_end);
+
+	// If the HT holds the next rows of the partition that is built partially, we probe the same data again
+	const auto probe_again = ht.partial_continued && retain_spill_collection;
+	if (partitioned && !probe_again) {
 		auto &partitions = global_partitions->GetPartitions();
-		if (partitions.empty() || ht.partition_start == partitions.size()) {
+		if (!partitions.empty() && current_radix_bits != ht.radix_bits) {
+			// The HT holds sub-partitions of a partition that does not fit in memory
+			GatherSubPartitions(current_radix_bits, current_start, current_end);
+		} else if (partitions.empty() || ht.partition_start == partitions.size()) {
 			// Can't probe, just make an empty one
 			global_spill_collection =
 			    make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), probe_types);
@@ -1167,7 +1387,9 @@ void ProbeSpill::PrepareNextProbe() {
 			}
 		}
 	}
-	consumer = make_uniq<ColumnDataConsumer>(*global_spill_collection, column_ids);
+	// If the next round of the HT holds more rows of the same partition, we have to keep the data to probe it again
+	retain_spill_collection = ht.partial_remaining;
+	consumer = make_uniq<ColumnDataConsumer>(*global_spill_collection, column_ids, !retain_spill_collection);
 	consumer->InitializeScan();
 }
 
@@ -0,0 +1,287 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)), state_size(0) {
+	vector<BoundAggregateExpression *> bindings;
+	for (auto &expr : aggregates) {
+		D_ASSERT(expr->expression_class == ExpressionClass::BOUND_AGGREGATE);
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		D_ASSERT(!aggr.IsDistinct());
+		D_ASSERT(aggr.function.update && aggr.function.finalize);
+		bindings.push_back(&aggr);
+	}
+	aggregate_objects = AggregateObject::CreateAggregateObjects(bindings);
+	for (auto &aggr : aggregate_objects) {
+		state_size += aggr.payload_size;
+	}
+}
+
+class StreamingAggregateState : public OperatorState {
+public:
+	explicit StreamingAggregateState(ClientContext &context, const PhysicalStreamingAggregate &op)
+	    : op(op), allocator(Allocator::Get(context)), has_open_group(false), addresses(LogicalType::POINTER),
+	      finalize_addresses(LogicalType::POINTER), group_starts(STANDARD_VECTOR_SIZE),
+	      distinct_sel(STANDARD_VECTOR_SIZE), filter_sel(STANDARD_VECTOR_SIZE) {
+		// slot 0 holds the states of the open group, i.e., the group that was still running at the end of the
+		// previous chunk, every chunk can start at most STANDARD_VECTOR_SIZE new groups
+		state_data = make_unsafe_uniq_array<data_t>((STANDARD_VECTOR_SIZE + 1) * MaxValue<idx_t>(op.state_size, 1));
+		open_group.resize(op.groups.size());
+		vector<LogicalType> payload_types;
+		for (auto &aggr : op.aggregates) {
+			for (auto &child : aggr->Cast<BoundAggregateExpression>().children) {
+				payload_types.push_back(child->return_type);
+			}
+		}
+		payload.InitializeEmpty(payload_types);
+		filtered_payload.InitializeEmpty(payload_types);
+	}
+
+	~StreamingAggregateState() override {
+		if (!has_open_group) {
+			return;
+		}
+		// the open group was never finalized: destroy its states
+		auto state_ptr = FlatVector::GetData<data_ptr_t>(finalize_addresses);
+		state_ptr[0] = GetSlot(0);
+		for (auto &aggr : op.aggregate_objects) {
+			if (aggr.function.destructor) {
+				AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+				aggr.function.destructor(finalize_addresses, aggr_input_data, 1);
+			}
+			state_ptr[0] += aggr.payload_size;
+		}
+	}
+
+public:
+	data_ptr_t GetSlot(idx_t slot) {
+		return state_data.get() + slot * op.state_size;
+	}
+
+	void InitializeSlot(idx_t slot) {
+		auto state_ptr = GetSlot(slot);
+		for (auto &aggr : op.aggregate_objects) {
+			aggr.function.initialize(state_ptr);
+			state_ptr += aggr.payload_size;
+		}
+	}
+
+public:
+	const PhysicalStreamingAggregate &op;
+	//! Allocator used by the aggregate states
+	ArenaAllocator allocator;
+	//! The states of the open group (slot 0) and of the groups that start in the current chunk
+	unsafe_unique_array<data_t> state_data;
+	//! Whether there is an open group
+	bool has_open_group;
+	//! The group values of the open group
+	vector<Value> open_group;
+	//! The state addresses of the rows of the input
+	Vector addresses;
+	//! The state addresses of the groups that are finalized
+	Vector finalize_addresses;
+	//! The first row of each group that starts in the current chunk
+	SelectionVector group_starts;
+	SelectionVector distinct_sel;
+	SelectionVector filter_sel;
+	//! Whether a new group starts at a row of the current chunk
+	bool new_group[STANDARD_VECTOR_SIZE];
+	//! The aggregate inputs
+	DataChunk payload;
+	DataChunk filtered_payload;
+};
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context.client, *this);
+}
+
+static void FinalizeGroups(const PhysicalStreamingAggregate &op, StreamingAggregateState &state, DataChunk &chunk,
+                           idx_t first_slot, idx_t count) {
+	auto addresses = FlatVector::GetData<data_ptr_t>(state.finalize_addresses);
+	for (idx_t i = 0; i < count; i++) {
+		addresses[i] = state.GetSlot(first_slot + i);
+	}
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregate_objects.size(); aggr_idx++) {
+		auto &aggr = op.aggregate_objects[aggr_idx];
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), state.allocator);
+		aggr.function.finalize(state.finalize_addresses, aggr_input_data, chunk.data[op.groups.size() + aggr_idx],
+		                       count, 0);
+		if (aggr.function.destructor) {
+			aggr.function.destructor(state.finalize_addresses, aggr_input_data, count);
+		}
+		VectorOperations::AddInPlace(state.finalize_addresses, aggr.payload_size, count);
+	}
+}
+
+static idx_t SelectFilteredRows(Vector &filter, idx_t count, SelectionVector &sel) {
+	UnifiedVectorFormat fdata;
+	filter.ToUnifiedFormat(count, fdata);
+	auto data = UnifiedVectorFormat::GetData<bool>(fdata);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = fdata.sel->get_index(i);
+		if (fdata.validity.RowIsValid(idx) && data[idx]) {
+			sel.set_index(result_count++, i);
+		}
+	}
+	return result_count;
+}
+
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate_p, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	const idx_t count = input.size();
+	if (count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// find the rows at which a new group starts
+	memset(state.new_group, 0, sizeof(bool) * count);
+	state.new_group[0] = !state.has_open_group;
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		auto &group = input.data[groups[group_idx]->Cast<BoundReferenceExpression>().index];
+		if (!state.new_group[0] && !Value::NotDistinctFrom(group.GetValue(0), state.open_group[group_idx])) {
+			state.new_group[0] = true;
+		}
+		if (count > 1) {
+			// compare every row with the previous row
+			group.Flatten(count);
+			Vector current(group, 1, count);
+			Vector previous(group, 0, count - 1);
+			auto distinct_count =
+			    VectorOperations::DistinctFrom(current, previous, nullptr, count - 1, &state.distinct_sel, nullptr);
+			for (idx_t i = 0; i < distinct_count; i++) {
+				state.new_group[state.distinct_sel.get_index(i) + 1] = true;
+			}
+		}
+	}
+
+	// assign the rows to the slots of their groups
+	auto addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	idx_t slot = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (state.new_group[i]) {
+			state.group_starts.set_index(slot, i);
+			slot++;
+			state.InitializeSlot(slot);
+		}
+		addresses[i] = state.GetSlot(slot);
+	}
+	const idx_t last_slot = slot;
+
+	// update the aggregates
+	state.payload.Reset();
+	idx_t payload_idx = 0;
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		for (idx_t child_idx = 0; child_idx < aggr.children.size(); child_idx++) {
+			auto &child_ref = aggr.children[child_idx]->Cast<BoundReferenceExpression>();
+			state.payload.data[payload_idx + child_idx].Reference(input.data[child_ref.index]);
+		}
+		payload_idx += aggr.children.size();
+	}
+	state.payload.SetCardinality(count);
+	payload_idx = 0;
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		auto &aggr_obj = aggregate_objects[aggr_idx];
+		AggregateInputData aggr_input_data(aggr_obj.GetFunctionData(), state.allocator);
+		if (aggr.filter) {
+			auto &filter = input.data[aggr.filter->Cast<BoundReferenceExpression>().index];
+			auto filtered_count = SelectFilteredRows(filter, count, state.filter_sel);
+			if (filtered_count > 0) {
+				for (idx_t child_idx = 0; child_idx < aggr.children.size(); child_idx++) {
+					state.filtered_payload.data[payload_idx + child_idx].Slice(
+					    state.payload.data[payload_idx + child_idx], state.filter_sel, filtered_count);
+				}
+				Vector filtered_addresses(state.addresses, state.filter_sel, filtered_count);
+				aggr_obj.function.update(state.filtered_payload.data.data() + payload_idx, aggr_input_data,
+				                         aggr_obj.child_count, filtered_addresses, filtered_count);
+			}
+		} else {
+			aggr_obj.function.update(state.payload.data.data() + payload_idx, aggr_input_data, aggr_obj.child_count,
+			                         state.addresses, count);
+		}
+		payload_idx += aggr_obj.child_count;
+		VectorOperations::AddInPlace(state.addresses, aggr_obj.payload_size, count);
+	}
+
+	// emit the groups that are complete, i.e., all groups except the last one
+	idx_t output_idx = 0;
+	if (state.has_open_group && last_slot > 0) {
+		// the open group ended at the start of this chunk
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			chunk.data[group_idx].SetValue(0, state.open_group[group_idx]);
+		}
+		output_idx = 1;
+	}
+	const idx_t new_groups = last_slot > 0 ? last_slot - 1 : 0;
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		auto &group = input.data[groups[group_idx]->Cast<BoundReferenceExpression>().index];
+		VectorOperations::Copy(group, chunk.data[group_idx], state.group_starts, new_groups, 0, output_idx);
+	}
+	const idx_t output_count = output_idx + new_groups;
+	if (output_count > 0) {
+		FinalizeGroups(*this, state, chunk, state.has_open_group ? 0 : 1, output_count);
+	}
+	chunk.SetCardinality(output_count);
+
+	// the last group stays open: move its states to slot 0
+	if (last_slot > 0) {
+		memcpy(state.GetSlot(0), state.GetSlot(last_slot), state_size);
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			auto &group = input.data[groups[group_idx]->Cast<BoundReferenceExpression>().index];
+			state.open_group[group_idx] = group.GetValue(count - 1);
+		}
+	}
+	state.has_open_group = true;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate_p,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (state.has_open_group) {
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			chunk.data[group_idx].SetValue(0, state.open_group[group_idx]);
+		}
+		FinalizeGroups(*this, state, chunk, 0, 1);
+		chunk.SetCardinality(1);
+		state.has_open_group = false;
+	}
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+string PhysicalStreamingAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (i > 0 || !groups.empty()) {
+			result += "\n";
+		}
+		result += aggregates[i]->GetName();
+		if (aggregate.filter) {
+			result += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -192,6 +192,11 @@ public:
 
 	//! Get the next task
 	Task NextTask(idx_t hash_bin);
+	//! Help to finalize a partition that another thread is building
+	void AssistFinalize();
+	//! Start and end finalizing the executors of a partition
+	void BeginFinalize(WindowPartitionSourceState &partition_source);
+	void EndFinalize(WindowPartitionSourceState &partition_source);
 
 	//! Context for executing computations
 	ClientContext &context;
@@ -203,6 +208,8 @@ public:
 	vector<HashGroupSourcePtr> built;
 	//! Serialise access to the built hash groups
 	mutable mutex built_lock;
+	//! The partitions whose executors are being finalized
+	vector<WindowPartitionSourceState *> finalizing;
 	//! The number of unfinished tasks
 	atomic<idx_t> tasks_remaining;
 
@@ -259,7 +266,7 @@ public:
 	using OrderMasks = PartitionGlobalHashGroup::OrderMasks;
 
 	WindowPartitionSourceState(ClientContext &context, WindowGlobalSourceState &gsource)
-	    : context(context), op(gsource.gsink.op), gsource(gsource), read_block_idx(0), unscanned(0) {
+	    : context(context), op(gsource.gsink.op), gsource(gsource), assistants(0), read_block_idx(0), unscanned(0) {
 		layout.Initialize(gsource.gsink.global_partition->payload_types);
 	}
 
@@ -287,6 +294,8 @@ public:
 
 	//! The bin number
 	idx_t hash_bin;
+	//! The number of threads that are helping to finalize the executors
+	idx_t assistants;
 
 	//! The next block to read.
 	mutable atomic<idx_t> read_block_idx;
@@ -435,10 +444,12 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 		input_idx += input_chunk.size();
 	}
 
-	//	TODO: Parallelization opportunity
+	//	Threads that have nothing to scan can help with finalizing
+	gsource.BeginFinalize(*this);
 	for (auto &wexec : executors) {
 		wexec->Finalize();
 	}
+	gsource.EndFinalize(*this);
 
 	// External scanning assumes all blocks are swizzled.
 	scanner->ReSwizzle();
@@ -578,13 +589,56 @@ WindowGlobalSourceState::Task WindowGlobalSourceState::NextTask(idx_t hash_bin)
 		}
 
 		//	If there is nothing to steal but there are unfinished partitions,
-		//	yield until any pending builds are done.
+		//	help to finalize them, and yield until any pending builds are done.
+		AssistFinalize();
 		TaskScheduler::YieldThread();
 	}
 
 	return Task();
 }
 
+void WindowGlobalSourceState::BeginFinalize(WindowPartitionSourceState &partition_source) {
+	lock_guard<mutex> built_guard(built_lock);
+	finalizing.emplace_back(&partition_source);
+}
+
+void WindowGlobalSourceState::EndFinalize(WindowPartitionSourceState &partition_source) {
+	{
+		lock_guard<mutex> built_guard(built_lock);
+		finalizing.erase(std::find(finalizing.begin(), finalizing.end(), &partition_source));
+	}
+
+	//	The assistants may still reference the executors, so wait until they are done
+	while (true) {
+		{
+			lock_guard<mutex> built_guard(built_lock);
+			if (!partition_source.assistants) {
+				return;
+			}
+		}
+		TaskScheduler::YieldThread();
+	}
+}
+
+void WindowGlobalSourceState::AssistFinalize() {
+	WindowPartitionSourceState *partition_source;
+	{
+		lock_guard<mutex> built_guard(built_lock);
+		if (finalizing.empty()) {
+			return;
+		}
+		partition_source = finalizing.back();
+		++partition_source->assistants;
+	}
+
+	for (auto &wexec : partition_source->executors) {
+		wexec->AssistFinalize();
+	}
+
+	lock_guard<mutex> built_guard(built_lock);
+	--partition_source->assistants;
+}
+
 void WindowLocalSourceState::UpdateBatchIndex() {
 	D_ASSERT(partition_source);
 	D_ASSERT(scanner.get());
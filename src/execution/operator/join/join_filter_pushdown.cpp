@@ -0,0 +1,172 @@
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/join_hashtable.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+
+namespace duckdb {
+
+struct JoinFilterKeyState {
+	//! Min/max statistics of the keys (if supported by the key type)
+	unique_ptr<BaseStatistics> stats;
+	//! Whether we have seen any non-NULL key
+	bool has_values = false;
+	//! Bloom filter over the hashes of the keys (if constructed)
+	unique_ptr<BloomFilter> bloom_filter;
+};
+
+static bool SupportsMinMaxFilter(const LogicalType &type) {
+	if (type.id() == LogicalTypeId::ENUM || BaseStatistics::GetStatsType(type) != StatisticsType::NUMERIC_STATS) {
+		return false;
+	}
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <class T>
+static void TemplatedUpdateMinMax(Vector &keys, idx_t count, JoinFilterKeyState &state) {
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		NumericStats::Update<T>(*state.stats, data[idx]);
+		state.has_values = true;
+	}
+}
+
+static void UpdateMinMax(Vector &keys, idx_t count, JoinFilterKeyState &state) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		return TemplatedUpdateMinMax<int8_t>(keys, count, state);
+	case PhysicalType::INT16:
+		return TemplatedUpdateMinMax<int16_t>(keys, count, state);
+	case PhysicalType::INT32:
+		return TemplatedUpdateMinMax<int32_t>(keys, count, state);
+	case PhysicalType::INT64:
+		return TemplatedUpdateMinMax<int64_t>(keys, count, state);
+	case PhysicalType::INT128:
+		return TemplatedUpdateMinMax<hugeint_t>(keys, count, state);
+	case PhysicalType::UINT8:
+		return TemplatedUpdateMinMax<uint8_t>(keys, count, state);
+	case PhysicalType::UINT16:
+		return TemplatedUpdateMinMax<uint16_t>(keys, count, state);
+	case PhysicalType::UINT32:
+		return TemplatedUpdateMinMax<uint32_t>(keys, count, state);
+	case PhysicalType::UINT64:
+		return TemplatedUpdateMinMax<uint64_t>(keys, count, state);
+	case PhysicalType::UINT128:
+		return TemplatedUpdateMinMax<uhugeint_t>(keys, count, state);
+	case PhysicalType::FLOAT:
+		return TemplatedUpdateMinMax<float>(keys, count, state);
+	case PhysicalType::DOUBLE:
+		return TemplatedUpdateMinMax<double>(keys, count, state);
+	default:
+		throw InternalException("Unsupported type for join filter min/max");
+	}
+}
+
+void JoinFilterPushdownInfo::ClearFilters(const PhysicalOperator &op) const {
+	for (auto &filter : probe_info) {
+		filter.dynamic_filters->ClearFilters(op);
+	}
+}
+
+void JoinFilterPushdownInfo::PushFilters(const PhysicalOperator &op, JoinHashTable &ht, idx_t probe_cardinality) const {
+	auto &data_collection = ht.GetDataCollection();
+	const auto build_count = data_collection.Count();
+	if (build_count == 0 || build_count > MAX_BUILD_SIZE) {
+		return;
+	}
+	// a bloom filter only pays off if the build side is small and the probe side is (much) larger
+	const bool build_bloom_filters = build_count <= MAX_BLOOM_BUILD_SIZE && build_count * 2 <= probe_cardinality;
+
+	// figure out which join conditions we need to derive filters for
+	vector<column_t> condition_ids;
+	for (auto &filter : probe_info) {
+		for (auto &column : filter.columns) {
+			if (std::find(condition_ids.begin(), condition_ids.end(), column.join_condition) == condition_ids.end()) {
+				condition_ids.push_back(column.join_condition);
+			}
+		}
+	}
+	vector<JoinFilterKeyState> key_states(condition_ids.size());
+	for (idx_t i = 0; i < condition_ids.size(); i++) {
+		auto &type = ht.condition_types[condition_ids[i]];
+		if (SupportsMinMaxFilter(type)) {
+			key_states[i].stats = NumericStats::CreateEmpty(type).ToUnique();
+		}
+		if (build_bloom_filters) {
+			key_states[i].bloom_filter = make_uniq<BloomFilter>(build_count);
+		}
+	}
+
+	// scan the keys of the hash table (the join conditions are stored first in the layout)
+	TupleDataScanState scan_state;
+	data_collection.InitializeScan(scan_state, condition_ids);
+	DataChunk keys;
+	data_collection.InitializeScanChunk(scan_state, keys);
+	Vector hashes(LogicalType::HASH);
+	while (data_collection.Scan(scan_state, keys)) {
+		for (idx_t i = 0; i < key_states.size(); i++) {
+			auto &key_state = key_states[i];
+			if (key_state.stats) {
+				UpdateMinMax(keys.data[i], keys.size(), key_state);
+			}
+			if (key_state.bloom_filter) {
+				VectorOperations::Hash(keys.data[i], hashes, keys.size());
+				key_state.bloom_filter->InsertHashes(hashes, keys.size());
+			}
+		}
+	}
+
+	// now push the filters into the probe-side scans
+	for (auto &filter : probe_info) {
+		for (auto &column : filter.columns) {
+			auto key_idx = std::find(condition_ids.begin(), condition_ids.end(), column.join_condition) -
+			               condition_ids.begin();
+			auto &key_state = key_states[key_idx];
+			auto &dynamic_filters = *filter.dynamic_filters;
+			if (key_state.stats && key_state.has_values) {
+				auto min_value = NumericStats::Min(*key_state.stats);
+				auto max_value = NumericStats::Max(*key_state.stats);
+				if (min_value == max_value) {
+					dynamic_filters.PushFilter(op, column.probe_column_index,
+					                           make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, min_value));
+				} else {
+					dynamic_filters.PushFilter(
+					    op, column.probe_column_index,
+					    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_value)));
+					dynamic_filters.PushFilter(
+					    op, column.probe_column_index,
+					    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_value)));
+				}
+			}
+			if (key_state.bloom_filter) {
+				dynamic_filters.PushFilter(op, column.probe_column_index, key_state.bloom_filter->Copy());
+			}
+		}
+	}
+}
+
+} // namespace duckdb
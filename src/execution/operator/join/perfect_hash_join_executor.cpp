@@ -1,142 +1,212 @@
 #include "duckdb/execution/operator/join/perfect_hash_join_executor.hpp"
 
 #include "duckdb/common/types/row/row_layout.hpp"
+#include "duckdb/common/types/row/tuple_data_iterator.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
 namespace duckdb {
 
 PerfectHashJoinExecutor::PerfectHashJoinExecutor(const PhysicalHashJoin &join_p, JoinHashTable &ht_p,
                                                  PerfectHashJoinStats perfect_join_stats)
-    : join(join_p), ht(ht_p), perfect_join_statistics(std::move(perfect_join_stats)) {
+    : join(join_p), ht(ht_p), perfect_join_statistics(std::move(perfect_join_stats)), has_duplicates(false),
+      unique_keys(0) {
+	// the offset of a combined key is the sum of the offsets of the keys, multiplied by their stride
+	idx_t stride = 1;
+	for (auto &key_range : perfect_join_statistics.build_ranges) {
+		key_strides.push_back(stride);
+		stride *= key_range + 1;
+	}
 }
 
 bool PerfectHashJoinExecutor::CanDoPerfectHashJoin() {
 	return perfect_join_statistics.is_build_small;
 }
 
+idx_t PerfectHashJoinExecutor::BuildSize() const {
+	return perfect_join_statistics.build_range + 1;
+}
+
 //===--------------------------------------------------------------------===//
 // Build
 //===--------------------------------------------------------------------===//
-bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
+void PerfectHashJoinExecutor::InitializePerfectHashTable() {
+	D_ASSERT(key_strides.size() == ht.equality_types.size());
 	// First, allocate memory for each build column
-	auto build_size = perfect_join_statistics.build_range + 1;
+	const auto build_size = BuildSize();
 	for (const auto &type : ht.build_types) {
 		perfect_hash_table.emplace_back(type, build_size);
+		// initialize the validity masks here, so the second phase of the build can write to them in parallel
+		FlatVector::Validity(perfect_hash_table.back()).Initialize(build_size);
 	}
 
 	// and for duplicate_checking
 	bitmap_build_idx = make_unsafe_uniq_array<bool>(build_size);
 	memset(bitmap_build_idx.get(), 0, sizeof(bool) * build_size); // set false
-
-	// Now fill columns with build data
-
-	return FullScanHashTable(key_type);
+	build_rows = make_unsafe_uniq_array<atomic<data_ptr_t>>(build_size);
+	for (idx_t i = 0; i < build_size; i++) {
+		build_rows[i].store(nullptr, std::memory_order_relaxed);
+	}
 }
 
-bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
+void PerfectHashJoinExecutor::BuildPerfectHashTable(idx_t chunk_idx_from, idx_t chunk_idx_to) {
 	auto &data_collection = ht.GetDataCollection();
 
-	// TODO: In a parallel finalize: One should exclusively lock and each thread should do one part of the code below.
-	Vector tuples_addresses(LogicalType::POINTER, ht.Count()); // allocate space for all the tuples
+	DataChunk keys;
+	keys.Initialize(Allocator::DefaultAllocator(), ht.equality_types);
+	vector<column_t> key_columns;
+	for (idx_t i = 0; i < ht.equality_types.size(); i++) {
+		key_columns.push_back(i);
+	}
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t offsets[STANDARD_VECTOR_SIZE];
 
-	idx_t key_count = 0;
-	if (data_collection.ChunkCount() > 0) {
-		JoinHTScanState join_ht_state(data_collection, 0, data_collection.ChunkCount(),
-		                              TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
+	idx_t local_unique_keys = 0;
+	TupleDataChunkIterator iterator(data_collection, TupleDataPinProperties::KEEP_EVERYTHING_PINNED, chunk_idx_from,
+	                                chunk_idx_to, false);
+	auto &row_locations = iterator.GetChunkState().row_locations;
+	const auto row_pointers = FlatVector::GetData<data_ptr_t>(row_locations);
+	do {
+		if (has_duplicates) {
+			// another thread found a duplicate, no need to continue
+			return;
+		}
+		// fetch the keys of the rows
+		const auto count = iterator.GetCurrentChunkCount();
+		keys.Reset();
+		data_collection.Gather(row_locations, *FlatVector::IncrementalSelectionVector(), count, key_columns, keys,
+		                       *FlatVector::IncrementalSelectionVector());
+		keys.SetCardinality(count);
 
-		// Go through all the blocks and fill the keys addresses
-		key_count = ht.FillWithHTOffsets(join_ht_state, tuples_addresses);
-	}
+		// compute their offsets (keys that are out of range can never match, so we do not consider them)
+		for (idx_t i = 0; i < count; i++) {
+			sel.set_index(i, i);
+		}
+		idx_t sel_count = count;
+		ComputeOffsets(keys, sel, sel_count, offsets);
 
-	// Scan the build keys in the hash table
-	Vector build_vector(key_type, key_count);
-	RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, key_count, 0);
+		// claim the entries of the rows
+		for (idx_t i = 0; i < sel_count; i++) {
+			const auto row_idx = sel.get_index(i);
+			data_ptr_t expected = nullptr;
+			if (!build_rows[offsets[row_idx]].compare_exchange_strong(expected, row_pointers[row_idx],
+			                                                         std::memory_order_relaxed)) {
+				has_duplicates = true;
+				return;
+			}
+		}
+		local_unique_keys += sel_count;
+	} while (iterator.Next());
+	unique_keys += local_unique_keys;
+}
 
-	// Now fill the selection vector using the build keys and create a sequential vector
-	// TODO: add check for fast pass when probe is part of build domain
-	SelectionVector sel_build(key_count + 1);
-	SelectionVector sel_tuples(key_count + 1);
-	bool success = FillSelectionVectorSwitchBuild(build_vector, sel_build, sel_tuples, key_count);
+bool PerfectHashJoinExecutor::HasDuplicates() const {
+	return has_duplicates;
+}
 
-	// early out
-	if (!success) {
-		return false;
-	}
-	if (unique_keys == perfect_join_statistics.build_range + 1 && !ht.has_null) {
-		perfect_join_statistics.is_build_dense = true;
-	}
-	key_count = unique_keys; // do not consider keys out of the range
+void PerfectHashJoinExecutor::FillPerfectHashTable(idx_t entry_idx_from, idx_t entry_idx_to) {
+	D_ASSERT(entry_idx_from % ValidityMask::BITS_PER_VALUE == 0);
+	auto &data_collection = ht.GetDataCollection();
 
-	// Full scan the remaining build columns and fill the perfect hash table
-	const auto build_size = perfect_join_statistics.build_range + 1;
-	for (idx_t i = 0; i < ht.build_types.size(); i++) {
-		auto &vector = perfect_hash_table[i];
-		D_ASSERT(vector.GetType() == ht.build_types[i]);
-		if (build_size > STANDARD_VECTOR_SIZE) {
-			auto &col_mask = FlatVector::Validity(vector);
-			col_mask.Initialize(build_size);
+	Vector row_locations(LogicalType::POINTER);
+	const auto row_pointers = FlatVector::GetData<data_ptr_t>(row_locations);
+	SelectionVector sel_build(STANDARD_VECTOR_SIZE);
+
+	idx_t entry_idx = entry_idx_from;
+	while (entry_idx < entry_idx_to) {
+		// collect the rows of a vector's worth of entries
+		idx_t key_count = 0;
+		for (; entry_idx < entry_idx_to && key_count < STANDARD_VECTOR_SIZE; entry_idx++) {
+			const auto row = build_rows[entry_idx].load(std::memory_order_relaxed);
+			if (!row) {
+				continue;
+			}
+			bitmap_build_idx[entry_idx] = true;
+			row_pointers[key_count] = row;
+			sel_build.set_index(key_count++, entry_idx);
 		}
 
-		const auto col_no = ht.condition_types.size() + i;
-		data_collection.Gather(tuples_addresses, sel_tuples, key_count, col_no, vector, sel_build);
+		// Full scan the remaining build columns and fill the perfect hash table
+		for (idx_t i = 0; i < ht.build_types.size(); i++) {
+			auto &vector = perfect_hash_table[i];
+			D_ASSERT(vector.GetType() == ht.build_types[i]);
+			const auto col_no = ht.condition_types.size() + i;
+			data_collection.Gather(row_locations, *FlatVector::IncrementalSelectionVector(), key_count, col_no, vector,
+			                       sel_build);
+		}
 	}
+}
 
-	return true;
+void PerfectHashJoinExecutor::FinalizePerfectHashTable() {
+	D_ASSERT(!has_duplicates);
+	if (unique_keys == BuildSize() && !ht.has_null) {
+		perfect_join_statistics.is_build_dense = true;
+	}
+	build_rows.reset();
 }
 
-bool PerfectHashJoinExecutor::FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec,
-                                                             SelectionVector &seq_sel_vec, idx_t count) {
-	switch (source.GetType().InternalType()) {
-	case PhysicalType::INT8:
-		return TemplatedFillSelectionVectorBuild<int8_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::INT16:
-		return TemplatedFillSelectionVectorBuild<int16_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::INT32:
-		return TemplatedFillSelectionVectorBuild<int32_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::INT64:
-		return TemplatedFillSelectionVectorBuild<int64_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT8:
-		return TemplatedFillSelectionVectorBuild<uint8_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT16:
-		return TemplatedFillSelectionVectorBuild<uint16_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT32:
-		return TemplatedFillSelectionVectorBuild<uint32_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT64:
-		return TemplatedFillSelectionVectorBuild<uint64_t>(source, sel_vec, seq_sel_vec, count);
-	default:
-		throw NotImplementedException("Type not supported for perfect hash join");
+void PerfectHashJoinExecutor::ComputeOffsets(DataChunk &keys, SelectionVector &sel, idx_t &sel_count,
+                                             idx_t offsets[]) const {
+	for (idx_t key_idx = 0; key_idx < keys.ColumnCount(); key_idx++) {
+		auto &source = keys.data[key_idx];
+		switch (source.GetType().InternalType()) {
+		case PhysicalType::INT8:
+			TemplatedComputeOffsets<int8_t>(source, keys.size(), key_idx, sel, sel_count, offsets);
+			break;
+		case PhysicalType::INT16:
+			TemplatedComputeOffsets<int16_t>(source, keys.size(), key_idx, sel, sel_count, offsets);
+			break;
+		case PhysicalType::INT32:
+			TemplatedComputeOffsets<int32_t>(source, keys.size(), key_idx, sel, sel_count, offsets);
+			break;
+		case PhysicalType::INT64:
+			TemplatedComputeOffsets<int64_t>(source, keys.size(), key_idx, sel, sel_count, offsets);
+			break;
+		case PhysicalType::UINT8:
+			TemplatedComputeOffsets<uint8_t>(source, keys.size(), key_idx, sel, sel_count, offsets);
+			break;
+		case PhysicalType::UINT16:
+			TemplatedComputeOffsets<uint16_t>(source, keys.size(), key_idx, sel, sel_count, offsets);
+			break;
+		case PhysicalType::UINT32:
+			TemplatedComputeOffsets<uint32_t>(source, keys.size(), key_idx, sel, sel_count, offsets);
+			break;
+		case PhysicalType::UINT64:
+			TemplatedComputeOffsets<uint64_t>(source, keys.size(), key_idx, sel, sel_count, offsets);
+			break;
+		default:
+			throw NotImplementedException("Type not supported for perfect hash join");
+		}
 	}
 }
 
 template <typename T>
-bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec,
-                                                                SelectionVector &seq_sel_vec, idx_t count) {
-	if (perfect_join_statistics.build_min.IsNull() || perfect_join_statistics.build_max.IsNull()) {
-		return false;
-	}
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
+void PerfectHashJoinExecutor::TemplatedComputeOffsets(Vector &source, idx_t count, idx_t key_idx,
+                                                      SelectionVector &sel, idx_t &sel_count, idx_t offsets[]) const {
+	auto min_value = perfect_join_statistics.build_min[key_idx].GetValueUnsafe<T>();
+	auto max_value = perfect_join_statistics.build_max[key_idx].GetValueUnsafe<T>();
+	const auto stride = key_strides[key_idx];
+
 	UnifiedVectorFormat vector_data;
 	source.ToUnifiedFormat(count, vector_data);
 	auto data = reinterpret_cast<T *>(vector_data.data);
-	// generate the selection vector
-	for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-		auto data_idx = vector_data.sel->get_index(i);
-		auto input_value = data[data_idx];
-		// add index to selection vector if value in the range
+	auto &validity_mask = vector_data.validity;
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < sel_count; ++i) {
+		// retrieve value from vector
+		const auto row_idx = sel.get_index(i);
+		const auto data_idx = vector_data.sel->get_index(row_idx);
+		if (!validity_mask.RowIsValid(data_idx)) {
+			continue;
+		}
+		const auto input_value = data[data_idx];
+		// keep the row if value in the range
 		if (min_value <= input_value && input_value <= max_value) {
-			auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-			sel_vec.set_index(sel_idx, idx);
-			if (bitmap_build_idx[idx]) {
-				return false;
-			} else {
-				bitmap_build_idx[idx] = true;
-				unique_keys++;
-			}
-			seq_sel_vec.set_index(sel_idx++, i);
+			const auto offset = idx_t(input_value - min_value) * stride; // subtract min value to get the position
+			offsets[row_idx] = key_idx == 0 ? offset : offsets[row_idx] + offset;
+			sel.set_index(result_count++, row_idx);
 		}
 	}
-	return true;
+	sel_count = result_count;
 }
 
 //===--------------------------------------------------------------------===//
@@ -151,14 +221,13 @@ public:
 		}
 		build_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
 		probe_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
-		seq_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
 	}
 
 	DataChunk join_keys;
 	ExpressionExecutor probe_executor;
 	SelectionVector build_sel_vec;
 	SelectionVector probe_sel_vec;
-	SelectionVector seq_sel_vec;
+	idx_t offsets[STANDARD_VECTOR_SIZE];
 };
 
 unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionContext &context) {
@@ -169,17 +238,29 @@ unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionCon
 OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionContext &context, DataChunk &input,
                                                                   DataChunk &result, OperatorState &state_p) {
 	auto &state = state_p.Cast<PerfectHashJoinState>();
-	// keeps track of how many probe keys have a match
-	idx_t probe_sel_count = 0;
 
 	// fetch the join keys from the chunk
 	state.join_keys.Reset();
 	state.probe_executor.Execute(input, state.join_keys);
 	// select the keys that are in the min-max range
-	auto &keys_vec = state.join_keys.data[0];
 	auto keys_count = state.join_keys.size();
-	// todo: add check for fast pass when probe is part of build domain
-	FillSelectionVectorSwitchProbe(keys_vec, state.build_sel_vec, state.probe_sel_vec, keys_count, probe_sel_count);
+	for (idx_t i = 0; i < keys_count; i++) {
+		state.probe_sel_vec.set_index(i, i);
+	}
+	idx_t in_range_count = keys_count;
+	ComputeOffsets(state.join_keys, state.probe_sel_vec, in_range_count, state.offsets);
+
+	// keeps track of how many probe keys have a match
+	idx_t probe_sel_count = 0;
+	for (idx_t i = 0; i < in_range_count; i++) {
+		// check for matches in the build
+		const auto row_idx = state.probe_sel_vec.get_index(i);
+		const auto offset = state.offsets[row_idx];
+		if (bitmap_build_idx[offset]) {
+			state.build_sel_vec.set_index(probe_sel_count, offset);
+			state.probe_sel_vec.set_index(probe_sel_count++, row_idx);
+		}
+	}
 
 	// If build is dense and probe is in build's domain, just reference probe
 	if (perfect_join_statistics.is_build_dense && keys_count == probe_sel_count) {
@@ -199,87 +280,4 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 	return OperatorResultType::NEED_MORE_INPUT;
 }
 
-void PerfectHashJoinExecutor::FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                             SelectionVector &probe_sel_vec, idx_t count,
-                                                             idx_t &probe_sel_count) {
-	switch (source.GetType().InternalType()) {
-	case PhysicalType::INT8:
-		TemplatedFillSelectionVectorProbe<int8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT16:
-		TemplatedFillSelectionVectorProbe<int16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT32:
-		TemplatedFillSelectionVectorProbe<int32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT64:
-		TemplatedFillSelectionVectorProbe<int64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT8:
-		TemplatedFillSelectionVectorProbe<uint8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT16:
-		TemplatedFillSelectionVectorProbe<uint16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT32:
-		TemplatedFillSelectionVectorProbe<uint32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT64:
-		TemplatedFillSelectionVectorProbe<uint64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	default:
-		throw NotImplementedException("Type not supported");
-	}
-}
-
-template <typename T>
-void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                                SelectionVector &probe_sel_vec, idx_t count,
-                                                                idx_t &probe_sel_count) {
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
-
-	UnifiedVectorFormat vector_data;
-	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	auto validity_mask = &vector_data.validity;
-	// build selection vector for non-dense build
-	if (validity_mask->AllValid()) {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
-		}
-	} else {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			if (!validity_mask->RowIsValid(data_idx)) {
-				continue;
-			}
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
-		}
-	}
-}
-
 } // namespace duckdb
@@ -59,6 +59,9 @@ public:
 		perfect_join_executor = make_uniq<PerfectHashJoinExecutor>(op, *hash_table, op.perfect_join_statistics);
 		// for external hash join
 		external = ClientConfig::GetConfig(context).force_external;
+		// for partitioned in-memory hash join
+		hash_table->prefer_partitioned =
+		    op.children[1]->estimated_cardinality >= JoinHashTable::PARTITIONED_BUILD_THRESHOLD;
 		// Set probe types
 		const auto &payload_types = op.children[0]->types;
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
@@ -67,6 +70,7 @@ public:
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
+	void SchedulePerfectFinalize(Pipeline &pipeline, Event &event);
 	void InitializeProbeSpill();
 
 public:
@@ -307,6 +311,155 @@ void HashJoinGlobalSinkState::ScheduleFinalize(Pipeline &pipeline, Event &event)
 	event.InsertEvent(std::move(new_event));
 }
 
+class HashJoinPerfectBuildTask : public ExecutorTask {
+public:
+	HashJoinPerfectBuildTask(shared_ptr<Event> event_p, ClientContext &context, PerfectHashJoinExecutor &executor_p,
+	                         idx_t chunk_idx_from_p, idx_t chunk_idx_to_p)
+	    : ExecutorTask(context), event(std::move(event_p)), executor(executor_p), chunk_idx_from(chunk_idx_from_p),
+	      chunk_idx_to(chunk_idx_to_p) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		executor.BuildPerfectHashTable(chunk_idx_from, chunk_idx_to);
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<Event> event;
+	PerfectHashJoinExecutor &executor;
+	idx_t chunk_idx_from;
+	idx_t chunk_idx_to;
+};
+
+class HashJoinPerfectFillTask : public ExecutorTask {
+public:
+	HashJoinPerfectFillTask(shared_ptr<Event> event_p, ClientContext &context, PerfectHashJoinExecutor &executor_p,
+	                        idx_t entry_idx_from_p, idx_t entry_idx_to_p)
+	    : ExecutorTask(context), event(std::move(event_p)), executor(executor_p), entry_idx_from(entry_idx_from_p),
+	      entry_idx_to(entry_idx_to_p) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		executor.FillPerfectHashTable(entry_idx_from, entry_idx_to);
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<Event> event;
+	PerfectHashJoinExecutor &executor;
+	idx_t entry_idx_from;
+	idx_t entry_idx_to;
+};
+
+class HashJoinPerfectFillEvent : public BasePipelineEvent {
+public:
+	HashJoinPerfectFillEvent(Pipeline &pipeline_p, HashJoinGlobalSinkState &sink)
+	    : BasePipelineEvent(pipeline_p), sink(sink) {
+	}
+
+	HashJoinGlobalSinkState &sink;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+
+		vector<shared_ptr<Task>> fill_tasks;
+		auto &executor = *sink.perfect_join_executor;
+		const auto build_size = executor.BuildSize();
+		const idx_t num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
+		if (num_threads == 1 || (build_size < PARALLEL_FILL_THRESHOLD && !context.config.verify_parallelism)) {
+			// Single-threaded fill
+			fill_tasks.push_back(make_uniq<HashJoinPerfectFillTask>(shared_from_this(), context, executor, 0, build_size));
+		} else {
+			// Parallel fill: each thread fills a range of the entries, which we align to the words of the validity masks
+			auto entries_per_thread = (build_size + num_threads - 1) / num_threads;
+			entries_per_thread = AlignValue<idx_t, ValidityMask::BITS_PER_VALUE>(entries_per_thread);
+
+			idx_t entry_idx = 0;
+			for (idx_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
+				auto entry_idx_from = entry_idx;
+				auto entry_idx_to = MinValue<idx_t>(entry_idx_from + entries_per_thread, build_size);
+				fill_tasks.push_back(make_uniq<HashJoinPerfectFillTask>(shared_from_this(), context, executor,
+				                                                        entry_idx_from, entry_idx_to));
+				entry_idx = entry_idx_to;
+				if (entry_idx == build_size) {
+					break;
+				}
+			}
+		}
+		SetTasks(std::move(fill_tasks));
+	}
+
+	void FinishEvent() override {
+		sink.perfect_join_executor->FinalizePerfectHashTable();
+	}
+
+	static constexpr const idx_t PARALLEL_FILL_THRESHOLD = 131072;
+};
+
+class HashJoinPerfectBuildEvent : public BasePipelineEvent {
+public:
+	HashJoinPerfectBuildEvent(Pipeline &pipeline_p, HashJoinGlobalSinkState &sink)
+	    : BasePipelineEvent(pipeline_p), sink(sink) {
+	}
+
+	HashJoinGlobalSinkState &sink;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+
+		vector<shared_ptr<Task>> build_tasks;
+		auto &ht = *sink.hash_table;
+		auto &executor = *sink.perfect_join_executor;
+		const auto chunk_count = ht.GetDataCollection().ChunkCount();
+		const idx_t num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
+		if (num_threads == 1 || (ht.Count() < PARALLEL_BUILD_THRESHOLD && !context.config.verify_parallelism)) {
+			// Single-threaded build
+			build_tasks.push_back(
+			    make_uniq<HashJoinPerfectBuildTask>(shared_from_this(), context, executor, 0, chunk_count));
+		} else {
+			// Parallel build
+			auto chunks_per_thread = MaxValue<idx_t>((chunk_count + num_threads - 1) / num_threads, 1);
+
+			idx_t chunk_idx = 0;
+			for (idx_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
+				auto chunk_idx_from = chunk_idx;
+				auto chunk_idx_to = MinValue<idx_t>(chunk_idx_from + chunks_per_thread, chunk_count);
+				build_tasks.push_back(make_uniq<HashJoinPerfectBuildTask>(shared_from_this(), context, executor,
+				                                                          chunk_idx_from, chunk_idx_to));
+				chunk_idx = chunk_idx_to;
+				if (chunk_idx == chunk_count) {
+					break;
+				}
+			}
+		}
+		SetTasks(std::move(build_tasks));
+	}
+
+	void FinishEvent() override {
+		if (sink.perfect_join_executor->HasDuplicates()) {
+			// In case of duplicates, use regular hash join
+			sink.perfect_join_executor.reset();
+			sink.ScheduleFinalize(*pipeline, *this);
+			return;
+		}
+		auto new_event = make_shared<HashJoinPerfectFillEvent>(*pipeline, sink);
+		InsertEvent(std::move(new_event));
+	}
+
+	static constexpr const idx_t PARALLEL_BUILD_THRESHOLD = 131072;
+};
+
+void HashJoinGlobalSinkState::SchedulePerfectFinalize(Pipeline &pipeline, Event &event) {
+	D_ASSERT(hash_table->Count() > 0);
+	perfect_join_executor->InitializePerfectHashTable();
+	auto new_event = make_shared<HashJoinPerfectBuildEvent>(pipeline, *this);
+	event.InsertEvent(std::move(new_event));
+}
+
 void HashJoinGlobalSinkState::InitializeProbeSpill() {
 	lock_guard<mutex> guard(lock);
 	if (!probe_spill) {
@@ -367,6 +520,10 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
                                             OperatorSinkFinalizeInput &input) const {
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
+	if (filter_pushdown) {
+		// remove filters that were pushed in a previous execution of this join
+		filter_pushdown->ClearFilters(*this);
+	}
 
 	sink.external = ht.RequiresExternalJoin(context.config, sink.local_hash_tables);
 	if (sink.external) {
@@ -390,17 +547,17 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 		}
 		sink.local_hash_tables.clear();
 		ht.Unpartition();
+		if (filter_pushdown) {
+			// the build side fits in memory: push filters derived from its keys into the probe-side scans
+			filter_pushdown->PushFilters(*this, ht, children[0]->estimated_cardinality);
+		}
 	}
 
-	// check for possible perfect hash table
-	auto use_perfect_hash = sink.perfect_join_executor->CanDoPerfectHashJoin();
-	if (use_perfect_hash) {
-		D_ASSERT(ht.equality_types.size() == 1);
-		auto key_type = ht.equality_types[0];
-		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable(key_type);
-	}
-	// In case of a large build side or duplicates, use regular hash join
-	if (!use_perfect_hash) {
+	// check for possible perfect hash table (which falls back to a regular hash join if there are duplicates)
+	if (sink.perfect_join_executor->CanDoPerfectHashJoin() && ht.Count() > 0) {
+		sink.SchedulePerfectFinalize(pipeline, event);
+	} else {
+		// In case of a large build side, use regular hash join
 		sink.perfect_join_executor.reset();
 		sink.ScheduleFinalize(pipeline, event);
 	}
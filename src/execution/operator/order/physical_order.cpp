@@ -185,8 +185,17 @@ SinkFinalizeType PhysicalOrder::Finalize(Pipeline &pipeline, Event &event, Clien
 }
 
 void PhysicalOrder::ScheduleMergeTasks(Pipeline &pipeline, Event &event, OrderGlobalSinkState &state) {
-	// Initialize global sort state for a round of merging
-	state.global_sort_state.InitializeMergeRound();
+	auto &global_sort_state = state.global_sort_state;
+	auto &ts = TaskScheduler::GetScheduler(pipeline.GetClientContext());
+	idx_t num_threads = ts.NumberOfThreads();
+	// With more than two sorted blocks, we try to merge all of them at once, in key ranges that are merged in parallel
+	// Otherwise (or if the keys are too skewed to split into ranges), we merge pairs of blocks in rounds
+	static constexpr idx_t RANGES_PER_THREAD = 4;
+	if (num_threads == 1 || global_sort_state.sorted_blocks.size() <= 2 ||
+	    !global_sort_state.InitializeRangeMerge(num_threads * RANGES_PER_THREAD)) {
+		// Initialize global sort state for a round of merging
+		global_sort_state.InitializeMergeRound();
+	}
 	auto new_event = make_shared<OrderMergeEvent>(state, pipeline);
 	event.InsertEvent(std::move(new_event));
 }
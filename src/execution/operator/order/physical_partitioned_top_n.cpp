@@ -0,0 +1,548 @@
+#include "duckdb/execution/operator/order/physical_partitioned_top_n.hpp"
+
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/types/row/row_layout.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+PhysicalPartitionedTopN::PhysicalPartitionedTopN(vector<LogicalType> types, vector<unique_ptr<Expression>> partitions,
+                                                 vector<BoundOrderByNode> orders, idx_t limit,
+                                                 idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::PARTITIONED_TOP_N, std::move(types), estimated_cardinality),
+      partitions(std::move(partitions)), orders(std::move(orders)), limit(limit) {
+	D_ASSERT(!this->partitions.empty());
+	D_ASSERT(limit > 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Heaps
+//===--------------------------------------------------------------------===//
+//! The hash table stores the index of every partition in a single "aggregate" state
+static idx_t PartitionIndexStateSize() {
+	return sizeof(idx_t);
+}
+
+static void PartitionIndexInitialize(data_ptr_t state) {
+	Store<idx_t>(DConstants::INVALID_INDEX, state);
+}
+
+//! The top-N rows of every partition. Rows are buffered in a sort state, which is periodically reduced to the top-N
+//! rows of every partition (like the TopNHeap of PhysicalTopN does globally). After a reduction, we know the N-th row
+//! of the partitions that have N rows, and discard the rows that do not beat it.
+class PartitionedTopNHeap {
+public:
+	PartitionedTopNHeap(ClientContext &context, Allocator &allocator, const PhysicalPartitionedTopN &op);
+
+	ClientContext &context;
+	Allocator &allocator;
+	BufferManager &buffer_manager;
+	const PhysicalPartitionedTopN &op;
+	//! Maps the partition keys to the index of the partition
+	unique_ptr<GroupedAggregateHashTable> ht;
+	//! The offset of the partition index in the rows of the hash table
+	idx_t partition_index_offset;
+	//! The amount of partitions
+	idx_t partition_count;
+
+	ExpressionExecutor partition_executor;
+	ExpressionExecutor order_executor;
+	DataChunk partition_chunk;
+	DataChunk order_chunk;
+	//! The partition index, followed by the order keys
+	DataChunk sort_chunk;
+	//! The input columns, followed by the partition index
+	DataChunk payload_chunk;
+	DataChunk scan_chunk;
+	//! The orders of the sort_chunk
+	vector<BoundOrderByNode> sort_orders;
+	RowLayout payload_layout;
+	unique_ptr<GlobalSortState> global_sort_state;
+	unique_ptr<LocalSortState> local_sort_state;
+	//! The amount of rows in the sort state
+	idx_t count;
+	bool is_sorted;
+
+	//! The order keys of the N-th row of the partitions (if known)
+	vector<Vector> boundaries;
+	vector<bool> has_boundary;
+	idx_t boundary_capacity;
+
+	Vector addresses;
+	Vector partition_indices;
+	SelectionVector new_groups;
+	SelectionVector boundary_sel;
+	SelectionVector check_sel;
+	SelectionVector final_sel;
+	SelectionVector true_sel;
+	SelectionVector false_sel;
+	SelectionVector new_remaining_sel;
+
+public:
+	void Sink(DataChunk &input);
+	void Combine(PartitionedTopNHeap &other);
+	void Reduce();
+	void Finalize();
+
+	//! Scans the sorted rows, only returning the top-N rows of every partition
+	void Scan(PayloadScanner &scanner, idx_t &current_partition, idx_t &rank, DataChunk &chunk);
+
+private:
+	void InitializeSortState();
+	void SinkSorted(DataChunk &chunk);
+	void GrowBoundaries(idx_t required_capacity);
+	idx_t CheckBoundaries(idx_t check_count, idx_t final_count);
+};
+
+PartitionedTopNHeap::PartitionedTopNHeap(ClientContext &context, Allocator &allocator,
+                                         const PhysicalPartitionedTopN &op)
+    : context(context), allocator(allocator), buffer_manager(BufferManager::GetBufferManager(context)), op(op),
+      partition_count(0), partition_executor(context), order_executor(context), count(0), is_sorted(false),
+      boundary_capacity(STANDARD_VECTOR_SIZE), addresses(LogicalType::POINTER), partition_indices(LogicalType::UBIGINT),
+      new_groups(STANDARD_VECTOR_SIZE), boundary_sel(STANDARD_VECTOR_SIZE), check_sel(STANDARD_VECTOR_SIZE),
+      final_sel(STANDARD_VECTOR_SIZE), true_sel(STANDARD_VECTOR_SIZE), false_sel(STANDARD_VECTOR_SIZE),
+      new_remaining_sel(STANDARD_VECTOR_SIZE) {
+	vector<LogicalType> partition_types;
+	for (auto &partition : op.partitions) {
+		partition_types.push_back(partition->return_type);
+		partition_executor.AddExpression(*partition);
+	}
+	AggregateFunction partition_index_function({}, LogicalType::UBIGINT, PartitionIndexStateSize,
+	                                           PartitionIndexInitialize, nullptr, nullptr, nullptr,
+	                                           FunctionNullHandling::DEFAULT_NULL_HANDLING);
+	vector<AggregateObject> aggregates;
+	aggregates.emplace_back(partition_index_function, nullptr, 0, AlignValue(PartitionIndexStateSize()),
+	                        AggregateType::NON_DISTINCT, PhysicalType::UINT64);
+	ht = make_uniq<GroupedAggregateHashTable>(context, allocator, partition_types, vector<LogicalType>(),
+	                                          std::move(aggregates));
+	partition_index_offset = ht->GetLayout().GetAggrOffset();
+
+	vector<LogicalType> order_types;
+	vector<LogicalType> sort_types {LogicalType::UBIGINT};
+	sort_orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST,
+	                         make_uniq<BoundReferenceExpression>(LogicalType::UBIGINT, 0));
+	for (auto &order : op.orders) {
+		auto &expr = *order.expression;
+		order_types.push_back(expr.return_type);
+		sort_types.push_back(expr.return_type);
+		order_executor.AddExpression(expr);
+		sort_orders.emplace_back(order.type, order.null_order,
+		                         make_uniq<BoundReferenceExpression>(expr.return_type, sort_orders.size()),
+		                         order.stats ? order.stats->ToUnique() : nullptr);
+		boundaries.emplace_back(expr.return_type, boundary_capacity);
+	}
+	has_boundary.resize(boundary_capacity, false);
+	auto payload_types = op.types;
+	payload_types.push_back(LogicalType::UBIGINT);
+
+	partition_chunk.Initialize(allocator, partition_types);
+	if (!order_types.empty()) {
+		order_chunk.Initialize(allocator, order_types);
+	}
+	sort_chunk.InitializeEmpty(sort_types);
+	payload_chunk.InitializeEmpty(payload_types);
+	scan_chunk.Initialize(allocator, payload_types);
+	payload_layout.Initialize(payload_types);
+	InitializeSortState();
+}
+
+void PartitionedTopNHeap::InitializeSortState() {
+	global_sort_state = make_uniq<GlobalSortState>(buffer_manager, sort_orders, payload_layout);
+	local_sort_state = make_uniq<LocalSortState>();
+	local_sort_state->Initialize(*global_sort_state, buffer_manager);
+	count = 0;
+	is_sorted = false;
+}
+
+void PartitionedTopNHeap::GrowBoundaries(idx_t required_capacity) {
+	if (required_capacity <= boundary_capacity) {
+		return;
+	}
+	auto new_capacity = NextPowerOfTwo(required_capacity);
+	for (auto &boundary : boundaries) {
+		boundary.Resize(boundary_capacity, new_capacity);
+	}
+	has_boundary.resize(new_capacity, false);
+	boundary_capacity = new_capacity;
+}
+
+idx_t PartitionedTopNHeap::CheckBoundaries(idx_t check_count, idx_t final_count) {
+	// compare the rows in "check_sel" with the N-th row of their partition, adding the ones that beat it to final_sel
+	auto &orders = op.orders;
+	SelectionVector remaining_sel(check_sel);
+	idx_t remaining_count = check_count;
+	for (idx_t i = 0; i < orders.size(); i++) {
+		auto &input = order_chunk.data[i];
+		Vector boundary(boundaries[i], boundary_sel, order_chunk.size());
+		idx_t true_count;
+		if (orders[i].null_order == OrderByNullType::NULLS_LAST) {
+			if (orders[i].type == OrderType::ASCENDING) {
+				true_count = VectorOperations::DistinctLessThan(input, boundary, &remaining_sel, remaining_count,
+				                                                &true_sel, &false_sel);
+			} else {
+				true_count = VectorOperations::DistinctGreaterThanNullsFirst(input, boundary, &remaining_sel,
+				                                                             remaining_count, &true_sel, &false_sel);
+			}
+		} else {
+			D_ASSERT(orders[i].null_order == OrderByNullType::NULLS_FIRST);
+			if (orders[i].type == OrderType::ASCENDING) {
+				true_count = VectorOperations::DistinctLessThanNullsFirst(input, boundary, &remaining_sel,
+				                                                          remaining_count, &true_sel, &false_sel);
+			} else {
+				true_count = VectorOperations::DistinctGreaterThan(input, boundary, &remaining_sel, remaining_count,
+				                                                   &true_sel, &false_sel);
+			}
+		}
+		if (true_count > 0) {
+			memcpy(final_sel.data() + final_count, true_sel.data(), true_count * sizeof(sel_t));
+			final_count += true_count;
+		}
+		idx_t false_count = remaining_count - true_count;
+		if (false_count == 0 || i + 1 == orders.size()) {
+			// rows that are equal to the N-th row do not have to be added either
+			break;
+		}
+		// the rows that are equal on this key are decided by the next key
+		remaining_count = VectorOperations::NotDistinctFrom(input, boundary, &false_sel, false_count,
+		                                                    &new_remaining_sel, nullptr);
+		remaining_sel.Initialize(new_remaining_sel);
+	}
+	return final_count;
+}
+
+void PartitionedTopNHeap::Sink(DataChunk &input) {
+	D_ASSERT(!is_sorted);
+	const auto input_count = input.size();
+	if (input_count == 0) {
+		return;
+	}
+	// look up the partitions, assigning an index to the new ones
+	partition_chunk.Reset();
+	partition_executor.Execute(input, partition_chunk);
+	auto new_group_count = ht->FindOrCreateGroups(partition_chunk, addresses, new_groups);
+	auto address_data = FlatVector::GetData<data_ptr_t>(addresses);
+	for (idx_t i = 0; i < new_group_count; i++) {
+		Store<idx_t>(partition_count++, address_data[new_groups.get_index(i)] + partition_index_offset);
+	}
+	GrowBoundaries(partition_count);
+
+	sort_chunk.Reset();
+	sort_chunk.data[0].Reference(partition_indices);
+	auto index_data = FlatVector::GetData<uint64_t>(partition_indices);
+	for (idx_t i = 0; i < input_count; i++) {
+		index_data[i] = Load<idx_t>(address_data[i] + partition_index_offset);
+	}
+	if (!op.orders.empty()) {
+		order_chunk.Reset();
+		order_executor.Execute(input, order_chunk);
+		for (idx_t i = 0; i < order_chunk.ColumnCount(); i++) {
+			sort_chunk.data[i + 1].Reference(order_chunk.data[i]);
+		}
+	}
+	sort_chunk.SetCardinality(input_count);
+
+	// discard the rows that do not beat the N-th row of their partition
+	idx_t final_count = 0;
+	idx_t check_count = 0;
+	for (idx_t i = 0; i < input_count; i++) {
+		auto partition_idx = index_data[i];
+		if (has_boundary[partition_idx]) {
+			boundary_sel.set_index(i, partition_idx);
+			check_sel.set_index(check_count++, i);
+		} else {
+			boundary_sel.set_index(i, 0);
+			final_sel.set_index(final_count++, i);
+		}
+	}
+	if (check_count > 0 && !op.orders.empty()) {
+		// without orders, any N rows of a partition will do: we can discard the rows of full partitions
+		final_count = CheckBoundaries(check_count, final_count);
+	}
+	if (final_count == 0) {
+		return;
+	}
+
+	for (idx_t col_idx = 0; col_idx < input.ColumnCount(); col_idx++) {
+		payload_chunk.data[col_idx].Reference(input.data[col_idx]);
+	}
+	payload_chunk.data.back().Reference(partition_indices);
+	payload_chunk.SetCardinality(input_count);
+	if (final_count < input_count) {
+		sort_chunk.Slice(final_sel, final_count);
+		payload_chunk.Slice(final_sel, final_count);
+	}
+	local_sort_state->SinkChunk(sort_chunk, payload_chunk);
+	count += final_count;
+}
+
+void PartitionedTopNHeap::SinkSorted(DataChunk &chunk) {
+	// re-add rows of a sorted heap (the input columns followed by the partition index of this heap)
+	sort_chunk.Reset();
+	sort_chunk.data[0].Reference(chunk.data.back());
+	if (!op.orders.empty()) {
+		order_chunk.Reset();
+		order_executor.Execute(chunk, order_chunk);
+		for (idx_t i = 0; i < order_chunk.ColumnCount(); i++) {
+			sort_chunk.data[i + 1].Reference(order_chunk.data[i]);
+		}
+	}
+	sort_chunk.SetCardinality(chunk.size());
+	local_sort_state->SinkChunk(sort_chunk, chunk);
+	count += chunk.size();
+}
+
+void PartitionedTopNHeap::Finalize() {
+	D_ASSERT(!is_sorted);
+	global_sort_state->AddLocalState(*local_sort_state);
+	global_sort_state->PrepareMergePhase();
+	while (global_sort_state->sorted_blocks.size() > 1) {
+		MergeSorter merge_sorter(*global_sort_state, buffer_manager);
+		merge_sorter.PerformInMergeRound();
+		global_sort_state->CompleteMergeRound();
+	}
+	is_sorted = true;
+}
+
+void PartitionedTopNHeap::Scan(PayloadScanner &scanner, idx_t &current_partition, idx_t &rank, DataChunk &chunk) {
+	D_ASSERT(is_sorted);
+	while (true) {
+		chunk.Reset();
+		scanner.Scan(chunk);
+		if (chunk.size() == 0) {
+			return;
+		}
+		// the rows are sorted on the partition index: keep the first N rows of every partition
+		auto index_data = FlatVector::GetData<uint64_t>(chunk.data.back());
+		idx_t result_count = 0;
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			if (index_data[i] != current_partition) {
+				current_partition = index_data[i];
+				rank = 0;
+			}
+			if (rank < op.limit) {
+				final_sel.set_index(result_count++, i);
+			}
+			rank++;
+		}
+		if (result_count == chunk.size()) {
+			return;
+		}
+		if (result_count > 0) {
+			chunk.Slice(final_sel, result_count);
+			return;
+		}
+	}
+}
+
+void PartitionedTopNHeap::Reduce() {
+	idx_t min_sort_threshold = STANDARD_VECTOR_SIZE * 5ULL;
+	if (partition_count <= NumericLimits<idx_t>::Maximum() / 2 / op.limit) {
+		min_sort_threshold = MaxValue<idx_t>(min_sort_threshold, 2ULL * partition_count * op.limit);
+	} else {
+		min_sort_threshold = NumericLimits<idx_t>::Maximum();
+	}
+	if (count < min_sort_threshold) {
+		// only reduce when we pass two times the top-N rows of all partitions, or 5 vectors (whichever comes last)
+		return;
+	}
+	Finalize();
+	auto old_global_state = std::move(global_sort_state);
+	InitializeSortState();
+	if (old_global_state->sorted_blocks.empty()) {
+		return;
+	}
+
+	PayloadScanner scanner(*old_global_state->sorted_blocks[0]->payload_data, *old_global_state);
+	idx_t current_partition = DConstants::INVALID_INDEX;
+	idx_t rank = 0;
+	SelectionVector boundary_rows(STANDARD_VECTOR_SIZE);
+	unsafe_vector<idx_t> boundary_partitions(STANDARD_VECTOR_SIZE);
+	while (true) {
+		scan_chunk.Reset();
+		scanner.Scan(scan_chunk);
+		if (scan_chunk.size() == 0) {
+			break;
+		}
+		// keep the first N rows of every partition, the N-th row becomes the boundary of its partition
+		auto index_data = FlatVector::GetData<uint64_t>(scan_chunk.data.back());
+		idx_t keep_count = 0;
+		idx_t boundary_count = 0;
+		for (idx_t i = 0; i < scan_chunk.size(); i++) {
+			if (index_data[i] != current_partition) {
+				current_partition = index_data[i];
+				rank = 0;
+			}
+			if (rank < op.limit) {
+				if (rank == op.limit - 1) {
+					boundary_rows.set_index(boundary_count, keep_count);
+					boundary_partitions[boundary_count++] = current_partition;
+				}
+				final_sel.set_index(keep_count++, i);
+			}
+			rank++;
+		}
+		if (keep_count == 0) {
+			continue;
+		}
+		if (keep_count < scan_chunk.size()) {
+			scan_chunk.Slice(final_sel, keep_count);
+		}
+		SinkSorted(scan_chunk);
+		for (idx_t i = 0; i < boundary_count; i++) {
+			auto partition_idx = boundary_partitions[i];
+			for (idx_t col_idx = 0; col_idx < boundaries.size(); col_idx++) {
+				boundaries[col_idx].SetValue(partition_idx, order_chunk.GetValue(col_idx, boundary_rows[i]));
+			}
+			has_boundary[partition_idx] = true;
+		}
+	}
+}
+
+void PartitionedTopNHeap::Combine(PartitionedTopNHeap &other) {
+	other.Finalize();
+	if (other.global_sort_state->sorted_blocks.empty()) {
+		return;
+	}
+	PayloadScanner scanner(*other.global_sort_state->sorted_blocks[0]->payload_data, *other.global_sort_state);
+	idx_t current_partition = DConstants::INVALID_INDEX;
+	idx_t rank = 0;
+	DataChunk input;
+	input.InitializeEmpty(op.types);
+	while (true) {
+		other.Scan(scanner, current_partition, rank, other.scan_chunk);
+		if (other.scan_chunk.size() == 0) {
+			break;
+		}
+		// strip the partition index of the other heap
+		for (idx_t col_idx = 0; col_idx < input.ColumnCount(); col_idx++) {
+			input.data[col_idx].Reference(other.scan_chunk.data[col_idx]);
+		}
+		input.SetCardinality(other.scan_chunk);
+		Sink(input);
+		Reduce();
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class PartitionedTopNGlobalState : public GlobalSinkState {
+public:
+	PartitionedTopNGlobalState(ClientContext &context, const PhysicalPartitionedTopN &op)
+	    : heap(context, BufferAllocator::Get(context), op) {
+	}
+
+	mutex lock;
+	PartitionedTopNHeap heap;
+};
+
+class PartitionedTopNLocalState : public LocalSinkState {
+public:
+	PartitionedTopNLocalState(ExecutionContext &context, const PhysicalPartitionedTopN &op)
+	    : heap(context.client, Allocator::Get(context.client), op) {
+	}
+
+	PartitionedTopNHeap heap;
+};
+
+unique_ptr<LocalSinkState> PhysicalPartitionedTopN::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<PartitionedTopNLocalState>(context, *this);
+}
+
+unique_ptr<GlobalSinkState> PhysicalPartitionedTopN::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<PartitionedTopNGlobalState>(context, *this);
+}
+
+SinkResultType PhysicalPartitionedTopN::Sink(ExecutionContext &context, DataChunk &chunk,
+                                             OperatorSinkInput &input) const {
+	auto &sink = input.local_state.Cast<PartitionedTopNLocalState>();
+	sink.heap.Sink(chunk);
+	sink.heap.Reduce();
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalPartitionedTopN::Combine(ExecutionContext &context,
+                                                       OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<PartitionedTopNGlobalState>();
+	auto &lstate = input.local_state.Cast<PartitionedTopNLocalState>();
+
+	// scan the local top-N of every partition and append it to the global heap
+	lock_guard<mutex> glock(gstate.lock);
+	gstate.heap.Combine(lstate.heap);
+
+	return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType PhysicalPartitionedTopN::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                   OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<PartitionedTopNGlobalState>();
+	gstate.heap.Finalize();
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+class PartitionedTopNSourceState : public GlobalSourceState {
+public:
+	PartitionedTopNSourceState(ClientContext &context, const PhysicalPartitionedTopN &op)
+	    : current_partition(DConstants::INVALID_INDEX), rank(0) {
+		auto payload_types = op.types;
+		payload_types.push_back(LogicalType::UBIGINT);
+		scan_chunk.Initialize(Allocator::Get(context), payload_types);
+	}
+
+	unique_ptr<PayloadScanner> scanner;
+	idx_t current_partition;
+	idx_t rank;
+	DataChunk scan_chunk;
+};
+
+unique_ptr<GlobalSourceState> PhysicalPartitionedTopN::GetGlobalSourceState(ClientContext &context) const {
+	return make_uniq<PartitionedTopNSourceState>(context, *this);
+}
+
+SourceResultType PhysicalPartitionedTopN::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                  OperatorSourceInput &input) const {
+	auto &state = input.global_state.Cast<PartitionedTopNSourceState>();
+	auto &heap = sink_state->Cast<PartitionedTopNGlobalState>().heap;
+	if (heap.global_sort_state->sorted_blocks.empty()) {
+		return SourceResultType::FINISHED;
+	}
+	if (!state.scanner) {
+		state.scanner =
+		    make_uniq<PayloadScanner>(*heap.global_sort_state->sorted_blocks[0]->payload_data, *heap.global_sort_state);
+	}
+	heap.Scan(*state.scanner, state.current_partition, state.rank, state.scan_chunk);
+	for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+		chunk.data[col_idx].Reference(state.scan_chunk.data[col_idx]);
+	}
+	chunk.SetCardinality(state.scan_chunk);
+	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
+}
+
+string PhysicalPartitionedTopN::ParamsToString() const {
+	string result;
+	result += "Top " + to_string(limit) + " per partition";
+	result += "\n[INFOSEPARATOR]";
+	for (auto &partition : partitions) {
+		result += "\n";
+		result += partition->ToString();
+	}
+	if (!orders.empty()) {
+		result += "\n[INFOSEPARATOR]";
+	}
+	for (idx_t i = 0; i < orders.size(); i++) {
+		result += "\n";
+		result += orders[i].expression->ToString() + " ";
+		result += orders[i].type == OrderType::DESCENDING ? "DESC" : "ASC";
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -6,6 +6,7 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -84,7 +85,8 @@ public:
 public:
 	void Sink(DataChunk &input);
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Reduces the heap to the top-N if it has grown large enough, returns whether the boundary values were updated
+	bool Reduce();
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
@@ -275,11 +277,11 @@ void TopNHeap::Finalize() {
 	sort_state.Finalize();
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	idx_t min_sort_threshold = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5ULL, 2ULL * (limit + offset));
 	if (sort_state.count < min_sort_threshold) {
 		// only reduce when we pass two times the limit + offset, or 5 vectors (whichever comes first)
-		return;
+		return false;
 	}
 	sort_state.Finalize();
 	TopNSortState new_state(*this);
@@ -306,6 +308,7 @@ void TopNHeap::Reduce() {
 	}
 
 	sort_state.Move(new_state);
+	return has_boundary_values;
 }
 
 void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk) {
@@ -435,11 +438,23 @@ unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &cont
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
+static void UpdateDynamicFilter(const PhysicalTopN &op, TopNHeap &heap) {
+	// every row that sorts after the boundary on the first order column cannot be part of the top-N: we keep rows that
+	// are equal to the boundary, as they can still win on the remaining order columns
+	D_ASSERT(heap.has_boundary_values);
+	auto comparison_type = op.orders[0].type == OrderType::ASCENDING ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+	                                                                 : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+	op.dynamic_filter->SetValue(comparison_type, heap.boundary_values.data[0].GetValue(0));
+}
+
 SinkResultType PhysicalTopN::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	// append to the local sink state
 	auto &sink = input.local_state.Cast<TopNLocalState>();
 	sink.heap.Sink(chunk);
-	sink.heap.Reduce();
+	if (sink.heap.Reduce() && dynamic_filter) {
+		// the boundary of the local top-N is also a boundary of the global top-N: push it into the scan
+		UpdateDynamicFilter(*this, sink.heap);
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -453,6 +468,9 @@ SinkCombineResultType PhysicalTopN::Combine(ExecutionContext &context, OperatorS
 	// scan the local top N and append it to the global heap
 	lock_guard<mutex> glock(gstate.lock);
 	gstate.heap.Combine(lstate.heap);
+	if (dynamic_filter && gstate.heap.has_boundary_values) {
+		UpdateDynamicFilter(*this, gstate.heap);
+	}
 
 	return SinkCombineResultType::FINISHED;
 }
@@ -2,15 +2,22 @@
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/function_binder.hpp"
+#include "duckdb/function/scalar/compressed_materialization_functions.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
@@ -149,10 +156,131 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+//! Returns the input column of a projected expression if it keeps equal values adjacent and distinct values apart
+static optional_ptr<BoundReferenceExpression> GetProjectedColumn(Expression &expr) {
+	if (expr.GetExpressionType() == ExpressionType::BOUND_REF) {
+		return &expr.Cast<BoundReferenceExpression>();
+	}
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+		return nullptr;
+	}
+	// the (de)compression functions inserted by compressed materialization are injective
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	if (func.function.bind != CompressedMaterializationFunctions::Bind || func.children.empty() ||
+	    func.children[0]->GetExpressionType() != ExpressionType::BOUND_REF) {
+		return nullptr;
+	}
+	// any other arguments are constants (e.g., the minimum value of integral compression)
+	for (idx_t child_idx = 1; child_idx < func.children.size(); child_idx++) {
+		if (!func.children[child_idx]->IsFoldable()) {
+			return nullptr;
+		}
+	}
+	return &func.children[0]->Cast<BoundReferenceExpression>();
+}
+
+static bool MapProjectedColumns(vector<idx_t> &columns, const vector<idx_t> &projection_map) {
+	if (projection_map.empty()) {
+		return true;
+	}
+	for (auto &column : columns) {
+		if (column >= projection_map.size()) {
+			return false;
+		}
+		column = projection_map[column];
+	}
+	return true;
+}
+
+static bool OrdersMatchGroups(const vector<BoundOrderByNode> &orders, const vector<idx_t> &group_columns) {
+	if (orders.size() < group_columns.size()) {
+		return false;
+	}
+	// the groups must be a permutation of a prefix of the orders
+	vector<idx_t> order_columns;
+	for (idx_t order_idx = 0; order_idx < group_columns.size(); order_idx++) {
+		auto &expr = *orders[order_idx].expression;
+		if (expr.GetExpressionType() != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		order_columns.push_back(expr.Cast<BoundReferenceExpression>().index);
+	}
+	auto sorted_groups = group_columns;
+	std::sort(sorted_groups.begin(), sorted_groups.end());
+	std::sort(order_columns.begin(), order_columns.end());
+	return sorted_groups == order_columns;
+}
+
+//! Whether the input of the aggregate is ordered on its groups, i.e., equal groups are adjacent
+static bool CanUseStreamingAggregate(LogicalAggregate &op) {
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	for (auto &expr : op.expressions) {
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		if (aggr.IsDistinct() || !aggr.function.update || !aggr.function.finalize) {
+			return false;
+		}
+	}
+	// the column bindings have been resolved: the groups reference the columns of the child
+	vector<idx_t> group_columns;
+	for (auto &group : op.groups) {
+		if (group->GetExpressionType() != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		auto index = group->Cast<BoundReferenceExpression>().index;
+		if (std::find(group_columns.begin(), group_columns.end(), index) == group_columns.end()) {
+			group_columns.push_back(index);
+		}
+	}
+	// follow the group columns down to an ORDER BY through projections and filters
+	reference<LogicalOperator> current = *op.children[0];
+	while (true) {
+		auto &child = current.get();
+		switch (child.type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &proj = child.Cast<LogicalProjection>();
+			for (auto &column : group_columns) {
+				if (column >= proj.expressions.size()) {
+					return false;
+				}
+				auto input_column = GetProjectedColumn(*proj.expressions[column]);
+				if (!input_column) {
+					return false;
+				}
+				column = input_column->index;
+			}
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_FILTER:
+			if (!MapProjectedColumns(group_columns, child.Cast<LogicalFilter>().projection_map)) {
+				return false;
+			}
+			break;
+		case LogicalOperatorType::LOGICAL_ORDER_BY: {
+			auto &order = child.Cast<LogicalOrder>();
+			return MapProjectedColumns(group_columns, order.projections) &&
+			       OrdersMatchGroups(order.orders, group_columns);
+		}
+		case LogicalOperatorType::LOGICAL_TOP_N: {
+			auto &top_n = child.Cast<LogicalTopN>();
+			// a top-N per partition does not order its output
+			return top_n.partitions.empty() && OrdersMatchGroups(top_n.orders, group_columns);
+		}
+		default:
+			return false;
+		}
+		current = *child.children[0];
+	}
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
+	// check this before planning the child, which can move the expressions out of the logical operators
+	bool use_streaming_aggregate = CanUseStreamingAggregate(op);
+
 	auto plan = CreatePlan(*op.children[0]);
 
 	plan = ExtractAggregateExpressions(std::move(plan), op.expressions, op.groups);
@@ -180,7 +308,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		// groups! create a GROUP BY aggregator
 		// use a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (use_streaming_aggregate) {
+			// the input is ordered on the groups: aggregate the groups one after the other
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
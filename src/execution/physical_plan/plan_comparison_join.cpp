@@ -47,12 +47,8 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	if (op.join_type != JoinType::INNER) {
 		return;
 	}
-	// with one condition
-	if (op.conditions.size() != 1) {
-		return;
-	}
-	// with propagated statistics
-	if (op.join_stats.empty()) {
+	// with propagated statistics for every condition
+	if (op.join_stats.empty() || op.join_stats.size() != 2 * op.conditions.size()) {
 		return;
 	}
 	for (auto &type : op.children[1]->types) {
@@ -81,44 +77,56 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 		}
 	}
 
-	// and when the build range is smaller than the threshold
-	auto &stats_build = *op.join_stats[0].get(); // lhs stats
-	if (!NumericStats::HasMinMax(stats_build)) {
-		return;
-	}
-	int64_t min_value, max_value;
-	if (!ExtractNumericValue(NumericStats::Min(stats_build), min_value) ||
-	    !ExtractNumericValue(NumericStats::Max(stats_build), max_value)) {
-		return;
-	}
-	int64_t build_range;
-	if (!TrySubtractOperator::Operation(max_value, min_value, build_range)) {
-		return;
-	}
-
-	// Fill join_stats for invisible join
-	auto &stats_probe = *op.join_stats[1].get(); // rhs stats
-	if (!NumericStats::HasMinMax(stats_probe)) {
-		return;
-	}
-
 	// The max size our build must have to run the perfect HJ
 	const idx_t MAX_BUILD_SIZE = 1000000;
-	join_state.probe_min = NumericStats::Min(stats_probe);
-	join_state.probe_max = NumericStats::Max(stats_probe);
-	join_state.build_min = NumericStats::Min(stats_build);
-	join_state.build_max = NumericStats::Max(stats_build);
-	join_state.estimated_cardinality = op.estimated_cardinality;
-	join_state.build_range = build_range;
-	if (join_state.build_range > MAX_BUILD_SIZE) {
-		return;
-	}
-	if (NumericStats::Min(stats_build) <= NumericStats::Min(stats_probe) &&
-	    NumericStats::Max(stats_probe) <= NumericStats::Max(stats_build)) {
-		join_state.is_probe_in_domain = true;
+	// and when the combined build range of all keys is smaller than the threshold
+	PerfectHashJoinStats result;
+	result.is_probe_in_domain = true;
+	idx_t build_size = 1;
+	for (idx_t cond_idx = 0; cond_idx < op.conditions.size(); cond_idx++) {
+		auto &stats_probe = *op.join_stats[2 * cond_idx].get();     // lhs stats
+		auto &stats_build = *op.join_stats[2 * cond_idx + 1].get(); // rhs stats
+		if (!NumericStats::HasMinMax(stats_build)) {
+			return;
+		}
+		int64_t min_value, max_value;
+		if (!ExtractNumericValue(NumericStats::Min(stats_build), min_value) ||
+		    !ExtractNumericValue(NumericStats::Max(stats_build), max_value)) {
+			return;
+		}
+		int64_t build_range;
+		if (!TrySubtractOperator::Operation(max_value, min_value, build_range)) {
+			return;
+		}
+		if (idx_t(build_range) > MAX_BUILD_SIZE) {
+			return;
+		}
+		// the keys are combined into a single offset, so the ranges multiply
+		build_size *= idx_t(build_range) + 1;
+		if (build_size > MAX_BUILD_SIZE + 1) {
+			return;
+		}
+		result.build_min.push_back(NumericStats::Min(stats_build));
+		result.build_max.push_back(NumericStats::Max(stats_build));
+		result.build_ranges.push_back(idx_t(build_range));
+		if (!NumericStats::HasMinMax(stats_probe)) {
+			// the probe keys are checked against the range of the build keys anyway
+			result.probe_min.emplace_back(stats_probe.GetType());
+			result.probe_max.emplace_back(stats_probe.GetType());
+			result.is_probe_in_domain = false;
+			continue;
+		}
+		result.probe_min.push_back(NumericStats::Min(stats_probe));
+		result.probe_max.push_back(NumericStats::Max(stats_probe));
+		if (NumericStats::Min(stats_build) > NumericStats::Min(stats_probe) ||
+		    NumericStats::Max(stats_probe) > NumericStats::Max(stats_build)) {
+			result.is_probe_in_domain = false;
+		}
 	}
-	join_state.is_build_small = true;
-	return;
+	result.estimated_cardinality = op.estimated_cardinality;
+	result.build_range = build_size - 1;
+	result.is_build_small = true;
+	join_state = std::move(result);
 }
 
 static void RewriteJoinCondition(Expression &expr, idx_t offset) {
@@ -193,9 +201,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
-		plan = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
-		                                   op.join_type, op.left_projection_map, op.right_projection_map,
-		                                   std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		auto hash_join = make_uniq<PhysicalHashJoin>(
+		    op, std::move(left), std::move(right), std::move(op.conditions), op.join_type, op.left_projection_map,
+		    op.right_projection_map, std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		hash_join->filter_pushdown = std::move(op.filter_pushdown);
+		plan = std::move(hash_join);
 
 	} else {
 		static constexpr const idx_t NESTED_LOOP_JOIN_THRESHOLD = 5;
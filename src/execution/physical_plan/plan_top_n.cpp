@@ -1,3 +1,4 @@
+#include "duckdb/execution/operator/order/physical_partitioned_top_n.hpp"
 #include "duckdb/execution/operator/order/physical_top_n.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
@@ -9,8 +10,17 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op)
 
 	auto plan = CreatePlan(*op.children[0]);
 
+	if (!op.partitions.empty()) {
+		D_ASSERT(op.offset == 0);
+		auto top_n = make_uniq<PhysicalPartitionedTopN>(op.types, std::move(op.partitions), std::move(op.orders),
+		                                                (idx_t)op.limit, op.estimated_cardinality);
+		top_n->children.push_back(std::move(plan));
+		return std::move(top_n);
+	}
+
 	auto top_n =
 	    make_uniq<PhysicalTopN>(op.types, std::move(op.orders), (idx_t)op.limit, op.offset, op.estimated_cardinality);
+	top_n->dynamic_filter = std::move(op.dynamic_filter);
 	top_n->children.push_back(std::move(plan));
 	return std::move(top_n);
 }
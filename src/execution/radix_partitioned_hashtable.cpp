@@ -127,6 +127,8 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+	//! If the ratio of groups to sunk rows in a full HT exceeds this, we skip lookups (pre-aggregation is ineffective)
+	static constexpr const double SKIP_LOOKUP_THRESHOLD = 0.95;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -289,12 +291,15 @@ public:
 	unique_ptr<GroupedAggregateHashTable> ht;
 	//! Chunk with group columns
 	DataChunk group_chunk;
+	//! Number of rows sunk into the HT since its count was last reset
+	idx_t sink_count;
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : sink_count(0) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -381,6 +386,20 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 	return true;
 }
 
+void DecideAdaptation(RadixHTGlobalSinkState &gstate, RadixHTLocalSinkState &lstate) {
+	auto &ht = *lstate.ht;
+	if (ht.SkipLookups() || gstate.active_threads < 2) {
+		// We've already decided, or we might be the only thread (then the HT is not combined again in the Finalize)
+		return;
+	}
+
+	// If (almost) every row created a new group, the lookups do not pay off
+	// We append every row as a new group instead, and aggregate them once when combining the partitions
+	if (double(ht.Count()) > gstate.config.SKIP_LOOKUP_THRESHOLD * double(lstate.sink_count)) {
+		ht.SetSkipLookups(true);
+	}
+}
+
 void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input,
                                      DataChunk &payload_input, const unsafe_vector<idx_t> &filter) const {
 	auto &gstate = input.global_state.Cast<RadixHTGlobalSinkState>();
@@ -395,16 +414,27 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 
 	auto &ht = *lstate.ht;
 	ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.sink_count += group_chunk.size();
+
+	if (ht.SkipLookups()) {
+		// We don't use the pointer table, but we still need to check if we need to repartition
+		MaybeRepartition(context.client, gstate, lstate);
+		return;
+	}
 
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
 	}
 
-	if (gstate.active_threads > 2) {
+	// The HT is full, check if pre-aggregation is effective
+	DecideAdaptation(gstate, lstate);
+
+	if (gstate.active_threads > 2 || ht.SkipLookups()) {
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
 		// This only works because we never resize the HT
 		ht.ClearPointerTable();
 		ht.ResetCount();
+		lstate.sink_count = 0;
 		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
 	}
 
@@ -415,6 +445,7 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 		// We repartitioned, but we didn't clear the pointer table / reset the count because we're on 1 or 2 threads
 		ht.ClearPointerTable();
 		ht.ResetCount();
+		lstate.sink_count = 0;
 	}
 
 	// TODO: combine early and often
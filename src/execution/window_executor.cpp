@@ -872,6 +872,51 @@ bool WindowAggregateExecutor::IsCustomAggregate() {
 	return (mode < WindowAggregationMode::COMBINE);
 }
 
+static bool IsSlidingBoundary(WindowBoundary boundary, const unique_ptr<Expression> &expr) {
+	switch (boundary) {
+	case WindowBoundary::CURRENT_ROW_ROWS:
+	case WindowBoundary::CURRENT_ROW_RANGE:
+		return true;
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+	case WindowBoundary::EXPR_FOLLOWING_ROWS:
+	case WindowBoundary::EXPR_PRECEDING_RANGE:
+	case WindowBoundary::EXPR_FOLLOWING_RANGE:
+		//	Offsets that change from row to row make the frames jump around
+		return expr && expr->IsFoldable();
+	default:
+		//	Unbounded frames can grow to the whole partition,
+		//	so a thread that starts in the middle of it would have to aggregate everything before it.
+		return false;
+	}
+}
+
+bool WindowAggregateExecutor::IsSlidingAggregate() {
+	if (!wexpr.aggregate || wexpr.distinct) {
+		return false;
+	}
+
+	// window exclusion punches holes into the frames
+	if (wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+
+	//	The removal only has to deal with a single argument
+	if (wexpr.children.size() != 1) {
+		return false;
+	}
+
+	AggregateObject aggr(wexpr);
+	if (!aggr.function.window_remove || aggr.function.destructor) {
+		return false;
+	}
+
+	if (mode >= WindowAggregationMode::COMBINE) {
+		return false;
+	}
+
+	return IsSlidingBoundary(wexpr.start, wexpr.start_expr) && IsSlidingBoundary(wexpr.end, wexpr.end_expr);
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result,
                               WindowExecutorState &lstate) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
@@ -903,6 +948,9 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
 		    make_uniq<WindowConstantAggregator>(aggr, wexpr.return_type, partition_mask, wexpr.exclude_clause, count);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
+	} else if (IsSlidingAggregate()) {
+		// add and remove the rows that enter and leave the frame
+		aggregator = make_uniq<WindowSlidingAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
@@ -1015,6 +1063,11 @@ void WindowAggregateExecutor::Finalize() {
 	aggregator->Finalize(stats);
 }
 
+void WindowAggregateExecutor::AssistFinalize() {
+	D_ASSERT(aggregator);
+	aggregator->AssistFinalize();
+}
+
 class WindowAggregateState : public WindowExecutorBoundsState {
 public:
 	WindowAggregateState(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
@@ -6,6 +6,7 @@
 #include "duckdb/execution/merge_sort_tree.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/execution/window_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include <numeric>
 #include <utility>
@@ -238,6 +239,241 @@ void WindowConstantAggregator::Evaluate(WindowAggregatorState &lstate, const Dat
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// WindowSlidingAggregator
+//===--------------------------------------------------------------------===//
+WindowSlidingAggregator::WindowSlidingAggregator(AggregateObject aggr, const LogicalType &result_type,
+                                                 const WindowExcludeMode exclude_mode_p, idx_t count)
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count) {
+}
+
+WindowSlidingAggregator::~WindowSlidingAggregator() {
+}
+
+void WindowSlidingAggregator::Finalize(const FrameStats &stats) {
+	WindowAggregator::Finalize(stats);
+
+	//	Combine the filter and the NULLs of the argument, so we know when a frame becomes empty
+	auto &input_mask = FlatVector::Validity(inputs.data[0]);
+	if (!filter_mask.IsMaskSet() && input_mask.AllValid()) {
+		return;
+	}
+	valid_bits.resize(ValidityMask::ValidityMaskSize(inputs.size()), ~validity_t(0));
+	valid_mask.Initialize(valid_bits.data());
+	for (idx_t i = 0; i < inputs.size(); ++i) {
+		if (!filter_mask.RowIsValid(i) || !input_mask.RowIsValid(i)) {
+			valid_mask.SetInvalid(i);
+		}
+	}
+}
+
+class WindowSlidingAggregatorState : public WindowAggregatorState {
+public:
+	explicit WindowSlidingAggregatorState(const WindowSlidingAggregator &gstate);
+	~WindowSlidingAggregatorState() override;
+
+	void Evaluate(const DataChunk &bounds, Vector &result, idx_t count);
+
+protected:
+	//! Buffers the valid rows of [begin, end) for the state of a result row
+	void Buffer(idx_t begin, idx_t end, data_ptr_t agg_state, bool add);
+	//! Flush the buffered rows into the result states
+	void Flush(bool add);
+	//! Combine a single state into another one
+	void CombineState(data_ptr_t source, data_ptr_t target);
+
+	//! The global state
+	const WindowSlidingAggregator &gstate;
+	//! The running state of the last frame
+	vector<data_t> frame_state;
+	//! The bounds of the last frame
+	idx_t frame_begin;
+	idx_t frame_end;
+	//! The number of valid rows in the last frame
+	idx_t frame_valid;
+	//! Data pointer that contains a vector of states, used for row aggregation
+	vector<data_t> state;
+	//! Reused result state container for the aggregate
+	Vector statef;
+	//! The pointers to the states of the buffered rows to add and to remove
+	Vector add_states;
+	Vector remove_states;
+	//! The buffered rows to add and to remove
+	SelectionVector add_sel;
+	SelectionVector remove_sel;
+	idx_t add_count;
+	idx_t remove_count;
+	//! Input data chunk, used for leaf aggregation
+	DataChunk leaves;
+	//! Single state pointers for combining
+	Vector combine_source;
+	Vector combine_target;
+	//! Whether a result state was aggregated from scratch
+	vector<bool> restarted;
+	//! Whether a result frame has no valid rows
+	vector<bool> empty;
+};
+
+WindowSlidingAggregatorState::WindowSlidingAggregatorState(const WindowSlidingAggregator &gstate)
+    : gstate(gstate), frame_state(gstate.state_size), frame_begin(0), frame_end(0), frame_valid(0),
+      state(gstate.state_size * STANDARD_VECTOR_SIZE), statef(LogicalType::POINTER), add_states(LogicalType::POINTER),
+      remove_states(LogicalType::POINTER), add_count(0), remove_count(0), combine_source(LogicalType::POINTER),
+      combine_target(LogicalType::POINTER), restarted(STANDARD_VECTOR_SIZE), empty(STANDARD_VECTOR_SIZE) {
+	gstate.aggr.function.initialize(frame_state.data());
+
+	auto &inputs = const_cast<DataChunk &>(gstate.GetInputs());
+	leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
+
+	add_sel.Initialize();
+	remove_sel.Initialize();
+
+	//	Build the finalise vector that just points to the result states
+	data_ptr_t state_ptr = state.data();
+	D_ASSERT(statef.GetVectorType() == VectorType::FLAT_VECTOR);
+	statef.SetVectorType(VectorType::CONSTANT_VECTOR);
+	statef.Flatten(STANDARD_VECTOR_SIZE);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; ++i) {
+		fdata[i] = state_ptr;
+		state_ptr += gstate.state_size;
+	}
+}
+
+WindowSlidingAggregatorState::~WindowSlidingAggregatorState() {
+}
+
+void WindowSlidingAggregatorState::Flush(bool add) {
+	auto &flush_count = add ? add_count : remove_count;
+	if (!flush_count) {
+		return;
+	}
+
+	auto &inputs = const_cast<DataChunk &>(gstate.GetInputs());
+	leaves.Reference(inputs);
+	leaves.Slice(add ? add_sel : remove_sel, flush_count);
+
+	auto &aggr = gstate.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	auto update = add ? aggr.function.update : aggr.function.window_remove;
+	update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), add ? add_states : remove_states, flush_count);
+
+	flush_count = 0;
+}
+
+void WindowSlidingAggregatorState::Buffer(idx_t begin, idx_t end, data_ptr_t agg_state, bool add) {
+	auto &valid_mask = gstate.valid_mask;
+	auto &sel = add ? add_sel : remove_sel;
+	auto &buffered = add ? add_count : remove_count;
+	auto pdata = FlatVector::GetData<data_ptr_t>(add ? add_states : remove_states);
+	for (auto f = begin; f < end; ++f) {
+		if (!valid_mask.RowIsValid(f)) {
+			continue;
+		}
+		pdata[buffered] = agg_state;
+		sel.set_index(buffered++, f);
+		if (add) {
+			++frame_valid;
+		} else {
+			--frame_valid;
+		}
+		if (buffered >= STANDARD_VECTOR_SIZE) {
+			Flush(add);
+		}
+	}
+}
+
+void WindowSlidingAggregatorState::CombineState(data_ptr_t source, data_ptr_t target) {
+	FlatVector::GetData<data_ptr_t>(combine_source)[0] = source;
+	FlatVector::GetData<data_ptr_t>(combine_target)[0] = target;
+
+	auto &aggr = gstate.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.combine(combine_source, combine_target, aggr_input_data, 1);
+}
+
+void WindowSlidingAggregatorState::Evaluate(const DataChunk &bounds, Vector &result, idx_t count) {
+	auto begins = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto ends = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+
+	auto &aggr = gstate.aggr;
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+
+	//	Every result state only collects the changes to the frame of the previous row
+	for (idx_t i = 0; i < count; ++i) {
+		aggr.function.initialize(fdata[i]);
+		restarted[i] = false;
+		empty[i] = false;
+
+		const auto begin = begins[i];
+		const auto end = ends[i];
+		if (begin >= end) {
+			//	Keep sliding from the last non-empty frame
+			empty[i] = true;
+			continue;
+		}
+
+		//	Start over if that is cheaper than adjusting the last frame (e.g., when we jump to another block)
+		const auto width = end - begin;
+		const auto slide = MaxValue(begin, frame_begin) - MinValue(begin, frame_begin) + MaxValue(end, frame_end) -
+		                   MinValue(end, frame_end);
+		if (width <= slide) {
+			restarted[i] = true;
+			frame_valid = 0;
+			Buffer(begin, end, fdata[i], true);
+		} else {
+			if (end > frame_end) {
+				Buffer(frame_end, end, fdata[i], true);
+			} else {
+				Buffer(end, frame_end, fdata[i], false);
+			}
+			if (begin < frame_begin) {
+				Buffer(begin, frame_begin, fdata[i], true);
+			} else {
+				Buffer(frame_begin, begin, fdata[i], false);
+			}
+		}
+		frame_begin = begin;
+		frame_end = end;
+		empty[i] = !frame_valid;
+	}
+	Flush(true);
+	Flush(false);
+
+	//	Accumulate the changes into the running states
+	for (idx_t i = 0; i < count; ++i) {
+		if (!restarted[i]) {
+			CombineState(i ? fdata[i - 1] : frame_state.data(), fdata[i]);
+		}
+	}
+
+	//	Remember the last frame for the next chunk
+	if (count) {
+		aggr.function.initialize(frame_state.data());
+		CombineState(fdata[count - 1], frame_state.data());
+	}
+
+	//	Rows without any valid input get the value of the empty aggregate
+	for (idx_t i = 0; i < count; ++i) {
+		if (empty[i]) {
+			aggr.function.initialize(fdata[i]);
+		}
+	}
+
+	//	Finalise the result aggregates and write to the result
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.finalize(statef, aggr_input_data, result, count, 0);
+}
+
+unique_ptr<WindowAggregatorState> WindowSlidingAggregator::GetLocalState() const {
+	return make_uniq<WindowSlidingAggregatorState>(*this);
+}
+
+void WindowSlidingAggregator::Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result,
+                                       idx_t count, idx_t row_idx) const {
+	auto &lsstate = lstate.Cast<WindowSlidingAggregatorState>();
+	lsstate.Evaluate(bounds, result, count);
+}
+
 //===--------------------------------------------------------------------===//
 // WindowCustomAggregator
 //===--------------------------------------------------------------------===//
@@ -601,7 +837,8 @@ void WindowNaiveAggregator::Evaluate(WindowAggregatorState &lstate, const DataCh
 //===--------------------------------------------------------------------===//
 WindowSegmentTree::WindowSegmentTree(AggregateObject aggr, const LogicalType &result_type, WindowAggregationMode mode_p,
                                      const WindowExcludeMode exclude_mode_p, idx_t count)
-    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p) {
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p),
+      building(false), build_level(0) {
 }
 
 void WindowSegmentTree::Finalize(const FrameStats &stats) {
@@ -615,6 +852,21 @@ void WindowSegmentTree::Finalize(const FrameStats &stats) {
 	}
 }
 
+void WindowSegmentTree::AssistFinalize() {
+	if (!building) {
+		return;
+	}
+
+	//	The state owns the memory of the nodes that we build, so it has to live as long as the tree
+	auto lstate = GetLocalState();
+	auto &ltstate = *lstate;
+	{
+		lock_guard<mutex> build_guard(build_lock);
+		build_states.emplace_back(std::move(lstate));
+	}
+	BuildTree(ltstate);
+}
+
 WindowSegmentTree::~WindowSegmentTree() {
 	if (!aggr.function.destructor) {
 		// nothing to destroy
@@ -826,9 +1078,6 @@ void WindowSegmentTreePart::Finalize(Vector &result, idx_t count) {
 void WindowSegmentTree::ConstructTree() {
 	D_ASSERT(inputs.ColumnCount() > 0);
 
-	//	Use a temporary scan state to build the tree
-	auto &gtstate = gstate->Cast<WindowSegmentTreeState>().part;
-
 	// compute space required to store internal nodes of segment tree
 	internal_nodes = 0;
 	idx_t level_nodes = inputs.size();
@@ -837,32 +1086,68 @@ void WindowSegmentTree::ConstructTree() {
 		internal_nodes += level_nodes;
 	} while (level_nodes > 1);
 	levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * state_size);
+
+	// compute where the levels start, so that the nodes of a level can be built in any order
 	levels_flat_start.push_back(0);
+	idx_t level_size = inputs.size();
+	while (level_size > 1) {
+		level_size = (level_size + (TREE_FANOUT - 1)) / TREE_FANOUT;
+		levels_flat_start.push_back(levels_flat_start.back() + level_size);
+	}
 
-	idx_t levels_flat_offset = 0;
-	idx_t level_current = 0;
-	// level 0 is data itself
-	idx_t level_size;
-	// iterate over the levels of the segment tree
-	while ((level_size =
-	            (level_current == 0 ? inputs.size() : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
-		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
-			// compute the aggregate for this entry in the segment tree
-			data_ptr_t state_ptr = levels_flat_native.get() + (levels_flat_offset * state_size);
-			aggr.function.initialize(state_ptr);
-			gtstate.WindowSegmentValue(*this, level_current, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
-			gtstate.FlushStates(level_current > 0);
+	// Corner case: single element in the window
+	const auto levels = levels_flat_start.size() - 1;
+	if (!levels) {
+		aggr.function.initialize(levels_flat_native.get());
+		return;
+	}
 
-			levels_flat_offset++;
+	// the levels are built in tasks, which other threads can pick up with AssistFinalize
+	build_started = make_uniq_array<atomic<idx_t>>(levels);
+	build_completed = make_uniq_array<atomic<idx_t>>(levels);
+	for (idx_t level_idx = 0; level_idx < levels; ++level_idx) {
+		build_started[level_idx] = 0;
+		build_completed[level_idx] = 0;
+	}
+	build_level = 0;
+	building = true;
+
+	//	Use the global state to build the tree
+	BuildTree(*gstate);
+	building = false;
+}
+
+void WindowSegmentTree::BuildTree(WindowAggregatorState &lstate) {
+	auto &part = lstate.Cast<WindowSegmentTreeState>().part;
+
+	const auto levels = levels_flat_start.size() - 1;
+	for (idx_t level_current = build_level; level_current < levels; level_current = build_level) {
+		const auto level_nodes = levels_flat_start[level_current + 1] - levels_flat_start[level_current];
+		const auto level_tasks = (level_nodes + (BUILD_TASK_NODES - 1)) / BUILD_TASK_NODES;
+		const auto task_idx = build_started[level_current]++;
+		if (task_idx >= level_tasks) {
+			//	The next level needs the nodes of this level, so wait until the other threads have built them
+			TaskScheduler::YieldThread();
+			continue;
 		}
 
-		levels_flat_start.push_back(levels_flat_offset);
-		level_current++;
-	}
+		// level 0 is data itself
+		const auto level_size =
+		    level_current == 0 ? inputs.size() : levels_flat_start[level_current] - levels_flat_start[level_current - 1];
+		const auto node_begin = task_idx * BUILD_TASK_NODES;
+		const auto node_end = MinValue(node_begin + BUILD_TASK_NODES, level_nodes);
+		for (idx_t node_idx = node_begin; node_idx < node_end; ++node_idx) {
+			// compute the aggregate for this entry in the segment tree
+			data_ptr_t state_ptr = levels_flat_native.get() + (levels_flat_start[level_current] + node_idx) * state_size;
+			aggr.function.initialize(state_ptr);
+			const auto pos = node_idx * TREE_FANOUT;
+			part.WindowSegmentValue(*this, level_current, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
+			part.FlushStates(level_current > 0);
+		}
 
-	// Corner case: single element in the window
-	if (levels_flat_offset == 0) {
-		aggr.function.initialize(levels_flat_native.get());
+		if (++build_completed[level_current] == level_tasks) {
+			++build_level;
+		}
 	}
 }
 
@@ -61,6 +61,9 @@ public:
 	void PrepareMergePhase();
 	//! Initializes the global sort state for another round of merging
 	void InitializeMergeRound();
+	//! Initializes the global sort state for a single merge of all sorted blocks, split into (at most) range_count key
+	//! ranges that are merged independently. Returns false if the keys cannot be split into ranges of similar size
+	bool InitializeRangeMerge(idx_t range_count);
 	//! Completes the cascaded merge sort round.
 	//! Pass true if you wish to use the radix data for further comparisons.
 	void CompleteMergeRound(bool keep_radix_data = false);
@@ -96,6 +99,13 @@ public:
 	idx_t num_pairs;
 	idx_t l_start;
 	idx_t r_start;
+
+	//! Progress in range merge stage
+	bool range_merge;
+	idx_t range_idx;
+	idx_t num_ranges;
+	//! The first row of every key range in every sorted block (num_ranges + 1 entries per block)
+	vector<vector<idx_t>> range_bounds;
 };
 
 struct LocalSortState {
@@ -151,7 +161,7 @@ struct MergeSorter {
 public:
 	MergeSorter(GlobalSortState &state, BufferManager &buffer_manager);
 
-	//! Finds and merges partitions until the current cascaded merge round is finished
+	//! Finds and merges partitions (or key ranges) until the current merge round is finished
 	void PerformInMergeRound();
 
 private:
@@ -178,9 +188,20 @@ private:
 	//! Compare values within SortedBlocks using a global index
 	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
 
-	//! Finds the next partition and merges it
+	//! Merges the next partition (at most block_capacity rows) of the left and right reader into the result
 	void MergePartition();
 
+	//! Merges the key ranges of all sorted blocks until the range merge is finished
+	void PerformRangeMerge();
+	//! Slices the rows of a key range out of every sorted block
+	void GetRange(idx_t range_idx, vector<unique_ptr<SortedBlock>> &runs, vector<idx_t> &run_entries);
+	//! Merges the slices of a key range with a cascade of two-way merges
+	void MergeRange(vector<unique_ptr<SortedBlock>> &runs, vector<idx_t> &run_entries,
+	                vector<unique_ptr<SortedBlock>> &result_blocks);
+	//! Merges two runs completely, into result blocks of at most block_capacity rows
+	void MergeRuns(SortedBlock &l_run, idx_t l_entry, SortedBlock &r_run, idx_t r_entry,
+	               vector<unique_ptr<SortedBlock>> &result_blocks);
+
 	//! Computes how the next 'count' tuples should be merged by setting the 'left_smaller' array
 	void ComputeMerge(const idx_t &count, bool left_smaller[]);
 
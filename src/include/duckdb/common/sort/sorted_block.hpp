@@ -28,8 +28,8 @@ public:
 	SortedData(SortedDataType type, const RowLayout &layout, BufferManager &buffer_manager, GlobalSortState &state);
 	//! Number of rows that this object holds
 	idx_t Count();
-	//! Initialize new block to write to
-	void CreateBlock();
+	//! Initialize new block to write (at least) capacity rows to
+	void CreateBlock(idx_t capacity);
 	//! Create a slice that holds the rows between the start and end indices
 	unique_ptr<SortedData> CreateSlice(idx_t start_block_index, idx_t end_block_index, idx_t end_entry_index);
 	//! Unswizzles all
@@ -58,10 +58,10 @@ public:
 	SortedBlock(BufferManager &buffer_manager, GlobalSortState &gstate);
 	//! Number of rows that this object holds
 	idx_t Count() const;
-	//! Initialize this block to write data to
-	void InitializeWrite();
-	//! Init new block to write to
-	void CreateBlock();
+	//! Initialize this block to write (at least) capacity rows to
+	void InitializeWrite(idx_t capacity);
+	//! Init new block to write (at least) capacity rows to
+	void CreateBlock(idx_t capacity);
 	//! Fill this sorted block by appending the blocks held by a vector of sorted blocks
 	void AppendSortedBlocks(vector<unique_ptr<SortedBlock>> &sorted_blocks);
 	//! Locate the block and entry index of a row in this block,
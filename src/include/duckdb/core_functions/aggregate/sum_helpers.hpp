@@ -155,6 +155,13 @@ struct BaseSumOperation {
 		ADDOP::template AddConstant<STATE, INPUT_TYPE>(state, input, count);
 	}
 
+	//! The inverse of Operation, only exact for integer (and decimal) sums
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Remove(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		STATEOP::template RemoveValues<STATE>(state, 1);
+		state.value -= input;
+	}
+
 	static bool IgnoreNull() {
 		return true;
 	}
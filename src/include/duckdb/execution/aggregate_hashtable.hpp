@@ -133,6 +133,11 @@ public:
 	void ResetCount();
 	//! Set the radix bits for this HT
 	void SetRadixBits(idx_t radix_bits);
+	//! Disables/enables lookups: if disabled, every row is added as a new group (creating duplicate groups that must
+	//! be combined later), which is cheaper if (almost) every group is unique anyway
+	void SetSkipLookups(bool skip_lookups);
+	//! Whether lookups are disabled
+	bool SkipLookups() const;
 	//! Initializes the PartitionedTupleData
 	void InitializePartitionedData();
 
@@ -166,6 +171,8 @@ private:
 
 	//! The number of radix bits to partition by
 	idx_t radix_bits;
+	//! Whether we skip lookups, i.e., add every row as a new group
+	bool skip_lookups;
 	//! The data of the HT
 	unique_ptr<PartitionedTupleData> partitioned_data;
 
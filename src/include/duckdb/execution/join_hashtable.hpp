@@ -51,10 +51,12 @@ private:
    [SERIALIZED ROW][NEXT POINTER]
    There is a separate hash map of pointers that point into this table.
    This is what is used to resolve the hashes.
-   [POINTER]
-   [POINTER]
-   [POINTER]
-   The pointers are either NULL
+   [SALT][POINTER]
+   [SALT][POINTER]
+   [SALT][POINTER]
+   The pointers are either NULL or point to the head of a chain. The upper 16 bits of every entry are a salt: each
+   hash that is inserted into the entry sets one of its bits. Probes for hashes whose bit is not set can skip the
+   entry without chasing the pointers in its chain.
 */
 class JoinHashTable {
 public:
@@ -105,7 +107,6 @@ public:
 		idx_t ScanInnerJoin(DataChunk &keys, SelectionVector &result_vector);
 
 	public:
-		void InitializeSelectionVector(const SelectionVector *&current_sel);
 		void AdvancePointers();
 		void AdvancePointers(const SelectionVector &sel, idx_t sel_count);
 		void GatherResult(Vector &result, const SelectionVector &result_vector, const SelectionVector &sel_vector,
@@ -211,9 +212,10 @@ private:
 	                                                  const SelectionVector *&current_sel);
 	void Hash(DataChunk &keys, const SelectionVector &sel, idx_t count, Vector &hashes);
 
-	//! Apply a bitmask to the hashes
-	void ApplyBitmask(Vector &hashes, idx_t count);
-	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
+	//! Looks up the entries for the given hashes, and initializes the pointers to the heads of their chains. "count"
+	//! is updated to the number of hashes that may have a match, which are stored in match_sel
+	void GetRowPointers(Vector &hashes, const SelectionVector &sel, idx_t &count, Vector &pointers,
+	                    SelectionVector &match_sel);
 
 private:
 	//! Insert the given set of locations into the HT with the given set of hashes
@@ -269,6 +271,10 @@ public:
 		//! Scans and consumes the ColumnDataCollection
 		unique_ptr<ColumnDataConsumer> consumer;
 
+	private:
+		//! Gathers the probe data of the sub-partitions in the HT (of a partition that does not fit in memory)
+		void GatherSubPartitions(idx_t sub_radix_bits, idx_t sub_partition_start, idx_t sub_partition_end);
+
 	private:
 		JoinHashTable &ht;
 		mutex lock;
@@ -276,6 +282,8 @@ public:
 
 		//! Whether the probe data is partitioned
 		bool partitioned;
+		//! Whether the probe data of the current round is kept, because it is probed again in the next round
+		bool retain_spill_collection;
 		//! The types of the probe DataChunks
 		const vector<LogicalType> &probe_types;
 		//! The column ids
@@ -294,6 +302,11 @@ public:
 
 	//! Whether we are doing an external hash join
 	bool external;
+	//! Whether we prefer to build and probe in rounds of cache-sized partitions if the HT fits in memory, but not in
+	//! the CPU caches (this re-uses the external join, but as the data fits in memory, it is never written to disk)
+	bool prefer_partitioned;
+	//! Whether the rounds are cache-sized partitions of a HT that fits in memory
+	bool partitioned_in_memory;
 	//! The current number of radix bits used to partition
 	idx_t radix_bits;
 	//! The max size of the HT
@@ -301,6 +314,24 @@ public:
 	//! Total count
 	idx_t total_count;
 
+	//! Upper 16 bits of the pointer table entries are salt
+	static constexpr const hash_t SALT_MASK = 0xFFFF000000000000;
+	//! Lower 48 bits of the pointer table entries are the pointer
+	static constexpr const hash_t POINTER_MASK = 0x0000FFFFFFFFFFFF;
+	//! Gets the salt bit for the given hash (derived from its upper bits, as the lower bits determine the entry)
+	static inline hash_t ExtractSalt(const hash_t &hash) {
+		return hash_t(1) << (48 + (hash >> 60));
+	}
+	//! Gets the pointer to the head of the chain from a pointer table entry
+	static inline data_ptr_t GetPointer(const hash_t &entry) {
+		return reinterpret_cast<data_ptr_t>(static_cast<uintptr_t>(entry & POINTER_MASK));
+	}
+
+	//! The estimated build side cardinality from which on we prefer a partitioned in-memory join
+	static constexpr const idx_t PARTITIONED_BUILD_THRESHOLD = 16777216;
+	//! The target size of the HT of a single round of a partitioned in-memory join
+	static constexpr const idx_t PARTITIONED_HT_SIZE = 8388608;
+
 	//! Capacity of the pointer table given the ht count
 	//! (minimum of 1024 to prevent collision chance for small HT's)
 	static idx_t PointerTableCapacity(idx_t count) {
@@ -308,7 +339,7 @@ public:
 	}
 	//! Size of the pointer table (in bytes)
 	static idx_t PointerTableSize(idx_t count) {
-		return PointerTableCapacity(count) * sizeof(data_ptr_t);
+		return PointerTableCapacity(count) * sizeof(hash_t);
 	}
 
 	//! Whether we need to do an external join
@@ -322,15 +353,50 @@ public:
 	void Reset();
 	//! Build HT for the next partitioned probe round
 	bool PrepareExternalFinalize();
+	//! Whether a partition can be built partially, i.e., in multiple rounds that are each probed with all probe rows of
+	//! the partition, which is only correct if probe rows without a match are not part of the result
+	bool CanBuildPartially() const;
+	//! Get the radix bits and the first and last partition of the current probe round
+	void GetCurrentPartitions(idx_t &current_radix_bits, idx_t &current_start, idx_t &current_end) const;
 	//! Probe whatever we can, sink the rest into a thread-local HT
 	unique_ptr<ScanStructure> ProbeAndSpill(DataChunk &keys, TupleDataChunkState &key_state, DataChunk &payload,
 	                                        ProbeSpill &probe_spill, ProbeSpillLocalAppendState &spill_state,
 	                                        DataChunk &spill_chunk);
 
+private:
+	//! Whether the HT of a partition fits in memory
+	bool FitsInMemory(TupleDataCollection &partition) const;
+	//! The number of radix bits to split up a partition that does not fit in memory into sub-partitions that do
+	idx_t SubPartitionRadixBits(TupleDataCollection &partition, idx_t current_radix_bits) const;
+	//! Splits up the partition at partition_start, which does not fit in memory, into sub-partitions
+	void SubPartition(TupleDataCollection &partition);
+	//! Repartitions the remaining sub-partitions with more radix bits, returns false if that did not split up the next
+	//! sub-partition (e.g., because it consists of a single key)
+	bool RepartitionSubPartitions();
+	//! Moves the next sub-partitions into the data collection, returns false if all sub-partitions are done
+	bool PrepareSubPartitions();
+	//! Moves the next rows of a partition that does not fit in memory into the data collection
+	void BuildPartially(TupleDataCollection &partition);
+
 private:
 	//! First and last partition of the current probe round
 	idx_t partition_start;
 	idx_t partition_end;
+	//! Sub-partitions of the partition at partition_start, which does not fit in memory
+	unique_ptr<RadixPartitionedTupleData> sub_partitions;
+	//! The number of radix bits of the sub-partitions
+	idx_t sub_radix_bits;
+	//! First and last sub-partition of the current probe round
+	idx_t sub_partition_start;
+	idx_t sub_partition_end;
+	//! Whether repartitioning the sub-partitions failed to split up the next one
+	bool sub_partitioning_failed;
+	//! The scan state of the partition that we are building partially
+	unique_ptr<TupleDataScanState> partial_scan_state;
+	//! Whether the current round continues building the partition of the previous round
+	bool partial_continued;
+	//! Whether more rounds of the current partition follow
+	bool partial_remaining;
 };
 
 } // namespace duckdb
@@ -0,0 +1,49 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/join_filter_pushdown.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+class JoinHashTable;
+class PhysicalOperator;
+
+struct JoinFilterPushdownColumn {
+	//! The join condition that the filter is derived from (index into the conditions of the physical join)
+	idx_t join_condition;
+	//! The column of the probe-side table scan (index into its column_ids) that the filter is pushed into
+	idx_t probe_column_index;
+};
+
+struct JoinFilterPushdownFilter {
+	//! The dynamic filters of the probe-side table scan
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The columns of the table scan that filters are pushed into
+	vector<JoinFilterPushdownColumn> columns;
+};
+
+//! JoinFilterPushdownInfo describes the probe-side table scans that a hash join pushes runtime filters into, once the
+//! build side has been materialized
+struct JoinFilterPushdownInfo {
+	//! The maximum build side size for which we derive filters
+	static constexpr const idx_t MAX_BUILD_SIZE = 16777216;
+	//! The maximum build side size for which we construct a bloom filter
+	static constexpr const idx_t MAX_BLOOM_BUILD_SIZE = 1048576;
+
+	vector<JoinFilterPushdownFilter> probe_info;
+
+public:
+	//! Removes the filters that were previously pushed by the join (if any)
+	void ClearFilters(const PhysicalOperator &op) const;
+	//! Derives min/max and bloom filters from the keys in the hash table and pushes them into the probe-side scans
+	void PushFilters(const PhysicalOperator &op, JoinHashTable &ht, idx_t probe_cardinality) const;
+};
+
+} // namespace duckdb
@@ -20,13 +20,17 @@ class HashJoinGlobalSinkState;
 class PhysicalHashJoin;
 
 struct PerfectHashJoinStats {
-	Value build_min;
-	Value build_max;
-	Value probe_min;
-	Value probe_max;
+	//! The min/max of the build and probe keys (one entry per join condition)
+	vector<Value> build_min;
+	vector<Value> build_max;
+	vector<Value> probe_min;
+	vector<Value> probe_max;
 	bool is_build_small = false;
 	bool is_build_dense = false;
 	bool is_probe_in_domain = false;
+	//! The range of the build keys (one entry per join condition)
+	vector<idx_t> build_ranges;
+	//! The range of the combined build key, i.e., the size of the perfect hash table minus one
 	idx_t build_range = 0;
 	idx_t estimated_cardinality = 0;
 };
@@ -44,21 +48,27 @@ public:
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context);
 	OperatorResultType ProbePerfectHashTable(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                         OperatorState &state);
-	bool BuildPerfectHashTable(LogicalType &type);
 
-private:
-	void FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec, SelectionVector &probe_sel_vec,
-	                                    idx_t count, idx_t &probe_sel_count);
-	template <typename T>
-	void TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-	                                       SelectionVector &probe_sel_vec, idx_t count, idx_t &prob_sel_count);
+	//! Allocates the perfect hash table (the build is done in two phases, which can both run in parallel)
+	void InitializePerfectHashTable();
+	//! First phase: claims the entries of the rows in the given chunk range of the data collection of the hash table
+	void BuildPerfectHashTable(idx_t chunk_idx_from, idx_t chunk_idx_to);
+	//! Whether the first phase found duplicate keys, i.e., we cannot do a perfect hash join
+	bool HasDuplicates() const;
+	//! Second phase: gathers the build columns of the given entry range (must be aligned to the validity mask)
+	void FillPerfectHashTable(idx_t entry_idx_from, idx_t entry_idx_to);
+	//! Cleans up after the second phase
+	void FinalizePerfectHashTable();
+	//! The number of entries in the perfect hash table
+	idx_t BuildSize() const;
 
-	bool FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                    idx_t count);
+private:
+	//! Computes the offsets of the keys in the perfect hash table, narrowing down "sel" to the rows whose keys are in
+	//! the range of the perfect hash table
+	void ComputeOffsets(DataChunk &keys, SelectionVector &sel, idx_t &sel_count, idx_t offsets[]) const;
 	template <typename T>
-	bool TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                       idx_t count);
-	bool FullScanHashTable(LogicalType &key_type);
+	void TemplatedComputeOffsets(Vector &source, idx_t count, idx_t key_idx, SelectionVector &sel, idx_t &sel_count,
+	                             idx_t offsets[]) const;
 
 private:
 	const PhysicalHashJoin &join;
@@ -67,10 +77,16 @@ private:
 	PerfectHashTable perfect_hash_table;
 	//! Build and probe statistics
 	PerfectHashJoinStats perfect_join_statistics;
+	//! The stride of each key in the combined key (the first key varies fastest)
+	vector<idx_t> key_strides;
 	//! Stores the occurences of each value in the build side
 	unsafe_unique_array<bool> bitmap_build_idx;
+	//! Stores the row of each value in the build side (only during the build)
+	unsafe_unique_array<atomic<data_ptr_t>> build_rows;
+	//! Whether the build found duplicate keys
+	atomic<bool> has_duplicates;
 	//! Stores the number of unique keys in the build side
-	idx_t unique_keys = 0;
+	atomic<idx_t> unique_keys;
 };
 
 } // namespace duckdb
@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/order/physical_partitioned_top_n.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/bound_query_node.hpp"
+
+namespace duckdb {
+
+//! PhysicalPartitionedTopN computes the top-N rows of every partition, e.g., for
+//! "QUALIFY row_number() OVER (PARTITION BY k ORDER BY ts) <= N". The partitions are kept in a hash table, and rows that
+//! do not beat the N-th row of their partition are discarded early. The output is not ordered.
+class PhysicalPartitionedTopN : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::PARTITIONED_TOP_N;
+
+public:
+	PhysicalPartitionedTopN(vector<LogicalType> types, vector<unique_ptr<Expression>> partitions,
+	                        vector<BoundOrderByNode> orders, idx_t limit, idx_t estimated_cardinality);
+
+	//! The partitions
+	vector<unique_ptr<Expression>> partitions;
+	//! The order within every partition
+	vector<BoundOrderByNode> orders;
+	//! The amount of rows to emit per partition
+	idx_t limit;
+
+public:
+	// Source interface
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+
+public:
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+	bool ParallelSink() const override {
+		return true;
+	}
+
+	string ParamsToString() const override;
+};
+
+} // namespace duckdb
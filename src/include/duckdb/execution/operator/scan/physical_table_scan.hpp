@@ -42,6 +42,8 @@ public:
 	vector<string> names;
 	//! The table filters
 	unique_ptr<TableFilterSet> table_filters;
+	//! Filters that are pushed into the scan at execution time (e.g. by a hash join)
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 	//! Currently stores any filters applied to file names (as strings)
 	ExtraOperatorInfo extra_info;
 
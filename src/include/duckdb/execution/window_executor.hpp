@@ -148,6 +148,9 @@ public:
 
 	virtual void Finalize() {
 	}
+	//! Called by other threads while Finalize is running, so they can help with it
+	virtual void AssistFinalize() {
+	}
 
 	virtual unique_ptr<WindowExecutorState> GetExecutorState() const;
 
@@ -177,6 +180,7 @@ public:
 	bool IsConstantAggregate();
 	bool IsCustomAggregate();
 	bool IsDistinctAggregate();
+	bool IsSlidingAggregate();
 
 	WindowAggregateExecutor(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
 	                        const ValidityMask &partition_mask, const ValidityMask &order_mask,
@@ -184,6 +188,7 @@ public:
 
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) override;
 	void Finalize() override;
+	void AssistFinalize() override;
 
 	unique_ptr<WindowExecutorState> GetExecutorState() const override;
 
@@ -56,6 +56,9 @@ public:
 	//	Build
 	virtual void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered);
 	virtual void Finalize(const FrameStats &stats);
+	//! Called by other threads while Finalize is running, so they can help with it
+	virtual void AssistFinalize() {
+	}
 
 	//	Probe
 	virtual unique_ptr<WindowAggregatorState> GetLocalState() const = 0;
@@ -133,6 +136,25 @@ private:
 	Vector statef;
 };
 
+//! Evaluates invertible aggregates (e.g., integer SUM, AVG or COUNT) by sliding a running state along the frames,
+//! adding the rows that enter the frame and removing the rows that leave it again.
+class WindowSlidingAggregator : public WindowAggregator {
+public:
+	WindowSlidingAggregator(AggregateObject aggr, const LogicalType &result_type_p, WindowExcludeMode exclude_mode_p,
+	                        idx_t partition_count);
+	~WindowSlidingAggregator() override;
+
+	void Finalize(const FrameStats &stats) override;
+
+	unique_ptr<WindowAggregatorState> GetLocalState() const override;
+	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
+	              idx_t row_idx) const override;
+
+	//! The rows that contribute to the aggregate (they pass the filter and are not NULL)
+	vector<validity_t> valid_bits;
+	ValidityMask valid_mask;
+};
+
 class WindowCustomAggregator : public WindowAggregator {
 public:
 	WindowCustomAggregator(AggregateObject aggr, const LogicalType &result_type_p,
@@ -160,6 +182,7 @@ public:
 	~WindowSegmentTree() override;
 
 	void Finalize(const FrameStats &stats) override;
+	void AssistFinalize() override;
 
 	unique_ptr<WindowAggregatorState> GetLocalState() const override;
 	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
@@ -167,6 +190,8 @@ public:
 
 public:
 	void ConstructTree();
+	//! Builds tasks of the tree levels (in order) until all levels are built
+	void BuildTree(WindowAggregatorState &lstate);
 
 	//! Use the combine API, if available
 	inline bool UseCombineAPI() const {
@@ -184,8 +209,23 @@ public:
 	//! Use the combine API, if available
 	WindowAggregationMode mode;
 
+	//! Whether the tree is being built, so other threads can help
+	atomic<bool> building;
+	//! The level of the tree that is being built
+	atomic<idx_t> build_level;
+	//! For each level, the next build task
+	unique_array<atomic<idx_t>> build_started;
+	//! For each level, the number of finished build tasks
+	unique_array<atomic<idx_t>> build_completed;
+	//! The states of the threads that helped to build the tree (these own the memory of the nodes that they built)
+	vector<unique_ptr<WindowAggregatorState>> build_states;
+	//! Serialise access to the build states
+	mutex build_lock;
+
 	// TREE_FANOUT needs to cleanly divide STANDARD_VECTOR_SIZE
 	static constexpr idx_t TREE_FANOUT = 16;
+	//! The number of nodes of a level that are built by a single task
+	static constexpr idx_t BUILD_TASK_NODES = STANDARD_VECTOR_SIZE;
 };
 
 class WindowDistinctAggregator : public WindowAggregator {
@@ -41,6 +41,27 @@ struct WindowPartitionInput {
 	const FrameStats stats;
 };
 
+//! Executes the Remove operation of an aggregate operation (the inverse of Operation) in place of Operation
+template <class OP>
+struct RemoveOperation {
+	template <class INPUT_TYPE, class STATE, class REMOVE_OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input) {
+		OP::template Remove<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+	}
+
+	template <class INPUT_TYPE, class STATE, class REMOVE_OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		for (idx_t i = 0; i < count; i++) {
+			OP::template Remove<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+		}
+	}
+
+	static bool IgnoreNull() {
+		return OP::IgnoreNull();
+	}
+};
+
 //! The type used for sizing hashed aggregate function states
 typedef idx_t (*aggregate_size_t)();
 //! The type used for initializing hashed aggregate function states
@@ -149,6 +170,8 @@ public:
 	aggregate_window_t window;
 	//! The windowed aggregate custom initialization function (may be null)
 	aggregate_wininit_t window_init = nullptr;
+	//! The windowed aggregate inverse of update, which removes inputs from the states again (may be null)
+	aggregate_update_t window_remove = nullptr;
 
 	//! The bind function (may be null)
 	bind_aggregate_function_t bind;
@@ -241,6 +264,13 @@ public:
 		AggregateExecutor::UnaryScatter<STATE, T, OP>(inputs[0], states, aggr_input_data, count);
 	}
 
+	template <class STATE, class T, class OP>
+	static void UnaryScatterRemove(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+	                               Vector &states, idx_t count) {
+		D_ASSERT(input_count == 1);
+		AggregateExecutor::UnaryScatter<STATE, T, RemoveOperation<OP>>(inputs[0], states, aggr_input_data, count);
+	}
+
 	template <class STATE, class INPUT_TYPE, class OP>
 	static void UnaryUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count, data_ptr_t state,
 	                        idx_t count) {
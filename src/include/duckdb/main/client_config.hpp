@@ -75,6 +75,8 @@ struct ClientConfig {
 	bool force_asof_iejoin = false;
 	//! Use range joins for inequalities, even if there are equality predicates
 	bool prefer_range_joins = false;
+	//! Build and probe hash joins in rounds of cache-sized partitions, even if the hash table is small
+	bool force_partitioned_hash_join = false;
 	//! If this context should also try to use the available replacement scans
 	//! True by default
 	bool use_replacement_scans = true;
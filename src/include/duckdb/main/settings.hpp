@@ -103,6 +103,15 @@ struct PreferRangeJoins {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct ForcePartitionedHashJoin {
+	static constexpr const char *Name = "force_partitioned_hash_join";                                     // NOLINT
+	static constexpr const char *Description = "Force partitioned hash joins with cache-sized partitions"; // NOLINT
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;                               // NOLINT
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct DebugWindowMode {
 	static constexpr const char *Name = "debug_window_mode";
 	static constexpr const char *Description = "DEBUG SETTING: switch window mode to use";
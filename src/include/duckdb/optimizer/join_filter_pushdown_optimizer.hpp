@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_filter_pushdown_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/column_binding.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalComparisonJoin;
+class LogicalGet;
+class LogicalTopN;
+
+//! The JoinFilterPushdownOptimizer links hash joins to the table scans on their probe side, so that the joins can push
+//! filters derived from their build side (min/max and bloom filters) into the scans during execution. It also links
+//! top-N operators to the scans of their first order column, so that rows that cannot make it into the top-N are
+//! filtered out by the scan
+class JoinFilterPushdownOptimizer : public LogicalOperatorVisitor {
+public:
+	explicit JoinFilterPushdownOptimizer(ClientContext &context);
+
+	void VisitOperator(LogicalOperator &op) override;
+
+private:
+	void GenerateJoinFilters(LogicalComparisonJoin &join);
+	void GenerateTopNFilter(LogicalTopN &top_n);
+	//! Whether the join is executed as a hash join that streams its probe side (LHS) through the join
+	bool IsHashJoin(LogicalComparisonJoin &join) const;
+	//! Follows the column binding down into the table scan that produces it (if any) - "binding" is updated in-place
+	optional_ptr<LogicalGet> FindProbeScan(LogicalOperator &op, ColumnBinding &binding) const;
+
+private:
+	ClientContext &context;
+};
+
+} // namespace duckdb
@@ -20,6 +20,9 @@ public:
 	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
 	//! Whether we can perform the optimization on this operator
 	static bool CanOptimize(LogicalOperator &op);
+	//! Whether the operator is a filter on the row number of a window that we can compute with a top-N per partition,
+	//! if so, also returns the limit
+	static bool CanOptimizePerPartition(LogicalOperator &op, int64_t &limit);
 };
 
 } // namespace duckdb
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+struct SelectionVector;
+struct ValidityMask;
+class Vector;
+
+//! BloomFilter is a register-blocked Bloom filter over the hashes of a set of values: every value sets a few bits in
+//! a single 64-bit block. It never rejects a value that was inserted, but it can accept values that were not.
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+	//! The maximum number of 64-bit blocks in a filter (8MB)
+	static constexpr const idx_t MAX_BLOCK_COUNT = 1048576;
+
+public:
+	BloomFilter();
+	//! Creates an empty filter that is sized for the given number of values (~16 bits per value)
+	explicit BloomFilter(idx_t expected_count);
+
+	//! The bit blocks of the filter (the number of blocks is always a power of two)
+	vector<uint64_t> blocks;
+
+public:
+	//! Inserts the given hashes into the filter
+	void InsertHashes(Vector &hashes, idx_t count);
+	//! Returns whether a value with the given hash may have been inserted into the filter
+	bool LookupHash(hash_t hash) const {
+		auto mask = HashMask(hash);
+		return (blocks[BlockIndex(hash)] & mask) == mask;
+	}
+	//! Filters the rows in the selection vector: keeps only the rows that are not NULL and may be present in the
+	//! filter
+	void FilterSelection(Vector &input, SelectionVector &sel, idx_t &approved_tuple_count, ValidityMask &mask) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	inline idx_t BlockIndex(hash_t hash) const {
+		return (hash >> 32) & (blocks.size() - 1);
+	}
+	static inline uint64_t HashMask(hash_t hash) {
+		return (uint64_t(1) << (hash & 63)) | (uint64_t(1) << ((hash >> 6) & 63)) |
+		       (uint64_t(1) << ((hash >> 12) & 63)) | (uint64_t(1) << ((hash >> 18) & 63));
+	}
+};
+
+} // namespace duckdb
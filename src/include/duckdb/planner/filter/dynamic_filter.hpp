@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/common/mutex.hpp"
+
+namespace duckdb {
+
+//! DynamicFilterData is the state of a dynamic filter, which is shared between the scan that evaluates the filter and
+//! the operator that updates it while the scan is running
+struct DynamicFilterData {
+	mutex lock;
+	//! The current filter (only set if initialized is true)
+	unique_ptr<ConstantFilter> filter;
+	bool initialized = false;
+
+	//! Sets the filter to "column [comparison_type] constant", if that is more selective than the current filter
+	void SetValue(ExpressionType comparison_type, const Value &constant);
+	//! Returns a copy of the current filter (or nullptr, if the filter is not initialized yet)
+	unique_ptr<ConstantFilter> GetFilter();
+};
+
+//! DynamicFilter is a constant comparison whose constant is updated during execution (e.g., the boundary of a top-N),
+//! it does not filter anything until it is initialized
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared state of the filter
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -12,8 +12,10 @@
 #include "duckdb/planner/logical_operator.hpp"
 
 namespace duckdb {
+struct DynamicFilterData;
 
-//! LogicalTopN represents a comibination of ORDER BY and LIMIT clause, using Min/Max Heap
+//! LogicalTopN represents a comibination of ORDER BY and LIMIT clause, using Min/Max Heap. If there are partitions, the
+//! top-N is computed for every partition (and the output is not ordered)
 class LogicalTopN : public LogicalOperator {
 public:
 	static constexpr const LogicalOperatorType TYPE = LogicalOperatorType::LOGICAL_TOP_N;
@@ -28,6 +30,11 @@ public:
 	int64_t limit;
 	//! The offset from the start to begin emitting elements
 	int64_t offset;
+	//! The partitions of the top-N (if any)
+	vector<unique_ptr<Expression>> partitions;
+	//! The filter on the first order column that is pushed into the table scan (if any), the top-N updates it with its
+	//! current boundary during execution
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	vector<ColumnBinding> GetColumnBindings() override {
@@ -12,16 +12,22 @@
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/enums/filter_propagate_result.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/common/reference_map.hpp"
 
 namespace duckdb {
 class BaseStatistics;
+class PhysicalOperator;
 
 enum class TableFilterType : uint8_t {
 	CONSTANT_COMPARISON = 0, // constant comparison (e.g. =C, >C, >=C, <C, <=C)
 	IS_NULL = 1,
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
-	CONJUNCTION_AND = 4
+	CONJUNCTION_AND = 4,
+	BLOOM_FILTER = 5,
+	DYNAMIC_FILTER = 6
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -41,6 +47,7 @@ public:
 	virtual bool Equals(const TableFilter &other) const {
 		return filter_type != other.filter_type;
 	}
+	virtual unique_ptr<TableFilter> Copy() const = 0;
 
 	virtual void Serialize(Serializer &serializer) const;
 	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
@@ -95,8 +102,28 @@ public:
 		return left->Equals(*right);
 	}
 
+	unique_ptr<TableFilterSet> Copy() const;
+
 	void Serialize(Serializer &serializer) const;
 	static TableFilterSet Deserialize(Deserializer &deserializer);
 };
 
+//! DynamicTableFilterSet holds filters that are only known at execution time (e.g. derived from the build side of a
+//! hash join), and that are pushed into a table scan before the scan is initialized
+class DynamicTableFilterSet {
+public:
+	//! Removes all filters that were pushed by the given operator
+	void ClearFilters(const PhysicalOperator &op);
+	//! Pushes a filter on the given column of the table scan, on behalf of the given operator
+	void PushFilter(const PhysicalOperator &op, idx_t column_index, unique_ptr<TableFilter> filter);
+
+	bool HasFilters() const;
+	//! Combines the dynamic filters with the filters that were pushed into the scan during planning (if any)
+	unique_ptr<TableFilterSet> GetFinalTableFilters(optional_ptr<TableFilterSet> existing_filters) const;
+
+private:
+	mutable mutex lock;
+	reference_map_t<const PhysicalOperator, unique_ptr<TableFilterSet>> filters;
+};
+
 } // namespace duckdb
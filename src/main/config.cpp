@@ -61,6 +61,7 @@ static ConfigurationOption internal_options[] = {DUCKDB_GLOBAL(AccessModeSetting
                                                  DUCKDB_LOCAL(DebugForceNoCrossProduct),
                                                  DUCKDB_LOCAL(DebugAsOfIEJoin),
                                                  DUCKDB_LOCAL(PreferRangeJoins),
+                                                 DUCKDB_LOCAL(ForcePartitionedHashJoin),
                                                  DUCKDB_GLOBAL(DebugWindowMode),
                                                  DUCKDB_GLOBAL_LOCAL(DefaultCollationSetting),
                                                  DUCKDB_GLOBAL(DefaultOrderSetting),
@@ -233,6 +233,21 @@ Value PreferRangeJoins::GetSetting(ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).prefer_range_joins);
 }
 
+//===--------------------------------------------------------------------===//
+// Force Partitioned Hash Join
+//===--------------------------------------------------------------------===//
+void ForcePartitionedHashJoin::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).force_partitioned_hash_join = ClientConfig().force_partitioned_hash_join;
+}
+
+void ForcePartitionedHashJoin::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).force_partitioned_hash_join = input.GetValue<bool>();
+}
+
+Value ForcePartitionedHashJoin::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).force_partitioned_hash_join);
+}
+
 //===--------------------------------------------------------------------===//
 // Default Collation
 //===--------------------------------------------------------------------===//
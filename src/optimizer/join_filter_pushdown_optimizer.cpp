@@ -0,0 +1,215 @@
+#include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
+
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+
+namespace duckdb {
+
+JoinFilterPushdownOptimizer::JoinFilterPushdownOptimizer(ClientContext &context) : context(context) {
+}
+
+void JoinFilterPushdownOptimizer::VisitOperator(LogicalOperator &op) {
+	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		GenerateJoinFilters(op.Cast<LogicalComparisonJoin>());
+	} else if (op.type == LogicalOperatorType::LOGICAL_TOP_N) {
+		GenerateTopNFilter(op.Cast<LogicalTopN>());
+	}
+	LogicalOperatorVisitor::VisitOperatorChildren(op);
+}
+
+bool JoinFilterPushdownOptimizer::IsHashJoin(LogicalComparisonJoin &join) const {
+	if (ClientConfig::GetConfig(context).prefer_range_joins) {
+		// the join might be planned as a range join, which materializes both sides
+		return false;
+	}
+	for (auto &cond : join.conditions) {
+		if (cond.comparison == ExpressionType::COMPARE_EQUAL ||
+		    cond.comparison == ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+			return true;
+		}
+	}
+	return false;
+}
+
+optional_ptr<LogicalGet> JoinFilterPushdownOptimizer::FindProbeScan(LogicalOperator &op,
+                                                                    ColumnBinding &binding) const {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		if (get.table_index != binding.table_index || !get.children.empty()) {
+			return nullptr;
+		}
+		if (!get.function.filter_pushdown || !get.GetTable()) {
+			// we only push dynamic filters into scans of base tables
+			return nullptr;
+		}
+		return &get;
+	}
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto &proj = op.Cast<LogicalProjection>();
+		if (proj.table_index != binding.table_index) {
+			return nullptr;
+		}
+		auto &expr = *proj.expressions[binding.column_index];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return nullptr;
+		}
+		binding = expr.Cast<BoundColumnRefExpression>().binding;
+		return FindProbeScan(*op.children[0], binding);
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+		return FindProbeScan(*op.children[0], binding);
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN: {
+		// we can only pass through the probe side of hash joins: the probe side is streamed through the join, so the
+		// scan is in the same pipeline as the join that pushes the filters, and cannot start before the build is done
+		auto &join = op.Cast<LogicalComparisonJoin>();
+		if (!IsHashJoin(join)) {
+			return nullptr;
+		}
+		return FindProbeScan(*op.children[0], binding);
+	}
+	default:
+		return nullptr;
+	}
+}
+
+static bool SupportsJoinFilter(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::STRUCT:
+	case PhysicalType::LIST:
+	case PhysicalType::ARRAY:
+		// table filters cannot be evaluated on nested columns
+		return false;
+	default:
+		return true;
+	}
+}
+
+void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &join) {
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::RIGHT_ANTI:
+		// rows from the probe side that have no match are not part of the result
+		break;
+	default:
+		return;
+	}
+	if (!IsHashJoin(join)) {
+		return;
+	}
+	auto pushdown_info = make_uniq<JoinFilterPushdownInfo>();
+	// the physical join moves the equality conditions to the front (preserving their order), so we keep track of the
+	// index that the condition will have there
+	idx_t equality_idx = 0;
+	for (auto &cond : join.conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL &&
+		    cond.comparison != ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+			continue;
+		}
+		const auto cond_idx = equality_idx++;
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL || cond.left->type != ExpressionType::BOUND_COLUMN_REF) {
+			continue;
+		}
+		auto binding = cond.left->Cast<BoundColumnRefExpression>().binding;
+		auto get = FindProbeScan(*join.children[0], binding);
+		if (!get) {
+			continue;
+		}
+		// the binding now refers to the column of the scan
+		auto column_id = get->column_ids[binding.column_index];
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			continue;
+		}
+		auto &column_type = get->returned_types[column_id];
+		if (column_type != cond.left->return_type || !SupportsJoinFilter(column_type)) {
+			continue;
+		}
+		if (!get->dynamic_filters) {
+			get->dynamic_filters = make_shared<DynamicTableFilterSet>();
+		}
+		optional_ptr<JoinFilterPushdownFilter> probe_filter;
+		for (auto &filter : pushdown_info->probe_info) {
+			if (filter.dynamic_filters == get->dynamic_filters) {
+				probe_filter = &filter;
+				break;
+			}
+		}
+		if (!probe_filter) {
+			JoinFilterPushdownFilter filter;
+			filter.dynamic_filters = get->dynamic_filters;
+			pushdown_info->probe_info.push_back(std::move(filter));
+			probe_filter = &pushdown_info->probe_info.back();
+		}
+		probe_filter->columns.push_back(JoinFilterPushdownColumn {cond_idx, binding.column_index});
+	}
+	if (!pushdown_info->probe_info.empty()) {
+		join.filter_pushdown = std::move(pushdown_info);
+	}
+}
+
+static bool SupportsTopNFilter(const LogicalType &type) {
+	// the boundary is compared with the storage comparison, so the order of the type has to be the order of its values
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void JoinFilterPushdownOptimizer::GenerateTopNFilter(LogicalTopN &top_n) {
+	if (!top_n.partitions.empty() || top_n.orders.empty()) {
+		return;
+	}
+	auto &order = top_n.orders[0];
+	if (order.null_order != OrderByNullType::NULLS_LAST || order.expression->type != ExpressionType::BOUND_COLUMN_REF) {
+		// the filter removes NULL values, so it cannot be used when they sort first
+		return;
+	}
+	auto binding = order.expression->Cast<BoundColumnRefExpression>().binding;
+	auto get = FindProbeScan(*top_n.children[0], binding);
+	if (!get) {
+		return;
+	}
+	auto column_id = get->column_ids[binding.column_index];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return;
+	}
+	auto &column_type = get->returned_types[column_id];
+	if (column_type != order.expression->return_type || !SupportsTopNFilter(column_type)) {
+		return;
+	}
+	top_n.dynamic_filter = make_shared<DynamicFilterData>();
+	get->table_filters.PushFilter(column_id, make_uniq<DynamicFilter>(top_n.dynamic_filter));
+}
+
+} // namespace duckdb
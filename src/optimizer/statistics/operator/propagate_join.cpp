@@ -19,6 +19,8 @@ void StatisticsPropagator::PropagateStatistics(LogicalComparisonJoin &join, uniq
 		auto &condition = join.conditions[i];
 		const auto stats_left = PropagateExpression(condition.left);
 		const auto stats_right = PropagateExpression(condition.right);
+		// the index of the statistics of this condition in join_stats (if any)
+		idx_t join_stats_idx = DConstants::INVALID_INDEX;
 		if (stats_left && stats_right) {
 			if ((condition.comparison == ExpressionType::COMPARE_DISTINCT_FROM ||
 			     condition.comparison == ExpressionType::COMPARE_NOT_DISTINCT_FROM) &&
@@ -29,6 +31,7 @@ void StatisticsPropagator::PropagateStatistics(LogicalComparisonJoin &join, uniq
 			}
 			auto prune_result = PropagateComparison(*stats_left, *stats_right, condition.comparison);
 			// Add stats to logical_join for perfect hash join
+			join_stats_idx = join.join_stats.size();
 			join.join_stats.push_back(stats_left->ToUnique());
 			join.join_stats.push_back(stats_right->ToUnique());
 			switch (prune_result) {
@@ -159,9 +162,10 @@ void StatisticsPropagator::PropagateStatistics(LogicalComparisonJoin &join, uniq
 			}
 
 			// Update join_stats when is already part of the join
-			if (join.join_stats.size() == 2) {
-				join.join_stats[0] = std::move(updated_stats_left);
-				join.join_stats[1] = std::move(updated_stats_right);
+			if (join_stats_idx != DConstants::INVALID_INDEX && join_stats_idx + 1 < join.join_stats.size() &&
+			    updated_stats_left && updated_stats_right) {
+				join.join_stats[join_stats_idx] = std::move(updated_stats_left);
+				join.join_stats[join_stats_idx + 1] = std::move(updated_stats_right);
 			}
 			break;
 		}
@@ -1,9 +1,15 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
+#include "duckdb/planner/operator/logical_window.hpp"
 
 namespace duckdb {
 
@@ -28,7 +34,100 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+static bool GetRowNumberLimit(Expression &expr, const ColumnBinding &row_number, int64_t &limit) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_COMPARISON) {
+		return false;
+	}
+	auto &comparison = expr.Cast<BoundComparisonExpression>();
+	auto comparison_type = comparison.GetExpressionType();
+	reference<Expression> column = *comparison.left;
+	reference<Expression> constant = *comparison.right;
+	if (column.get().GetExpressionType() != ExpressionType::BOUND_COLUMN_REF) {
+		// flip the comparison, e.g., "3 >= rn" becomes "rn <= 3"
+		std::swap(column, constant);
+		comparison_type = FlipComparisonExpression(comparison_type);
+	}
+	if (column.get().GetExpressionType() != ExpressionType::BOUND_COLUMN_REF ||
+	    column.get().Cast<BoundColumnRefExpression>().binding != row_number ||
+	    constant.get().GetExpressionType() != ExpressionType::VALUE_CONSTANT) {
+		return false;
+	}
+	auto &value = constant.get().Cast<BoundConstantExpression>().value;
+	if (value.IsNull() || !value.type().IsIntegral()) {
+		return false;
+	}
+	auto bound = value.GetValue<int64_t>();
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		limit = bound;
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		limit = bound - 1;
+		break;
+	default:
+		return false;
+	}
+	return limit > 0;
+}
+
+bool TopN::CanOptimizePerPartition(LogicalOperator &op, int64_t &limit) {
+	if (op.type != LogicalOperatorType::LOGICAL_FILTER ||
+	    op.children[0]->type != LogicalOperatorType::LOGICAL_WINDOW) {
+		return false;
+	}
+	auto &window = op.children[0]->Cast<LogicalWindow>();
+	if (window.expressions.size() != 1 ||
+	    window.expressions[0]->GetExpressionType() != ExpressionType::WINDOW_ROW_NUMBER) {
+		// other window functions would see only the top-N rows of their partition
+		return false;
+	}
+	auto &wexpr = window.expressions[0]->Cast<BoundWindowExpression>();
+	if (wexpr.filter_expr || (wexpr.partitions.empty() && wexpr.orders.empty())) {
+		return false;
+	}
+	// the partitions and orders are evaluated both by the top-N and by the window
+	for (auto &partition : wexpr.partitions) {
+		if (partition->HasSideEffects()) {
+			return false;
+		}
+	}
+	for (auto &order : wexpr.orders) {
+		if (order.expression->HasSideEffects()) {
+			return false;
+		}
+	}
+	// the filter must only keep the first rows of every partition
+	ColumnBinding row_number(window.window_index, 0);
+	bool found_limit = false;
+	for (auto &expr : op.expressions) {
+		int64_t expr_limit;
+		if (GetRowNumberLimit(*expr, row_number, expr_limit)) {
+			limit = found_limit ? MinValue(limit, expr_limit) : expr_limit;
+			found_limit = true;
+		}
+	}
+	return found_limit;
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
+	int64_t limit;
+	if (CanOptimizePerPartition(*op, limit)) {
+		// compute the top-N of every partition before the window, which then only has to sort the top-N rows
+		auto &window = op->children[0]->Cast<LogicalWindow>();
+		auto &wexpr = window.expressions[0]->Cast<BoundWindowExpression>();
+		vector<BoundOrderByNode> orders;
+		for (auto &order : wexpr.orders) {
+			orders.push_back(order.Copy());
+		}
+		auto topn = make_uniq<LogicalTopN>(std::move(orders), limit, 0);
+		for (auto &partition : wexpr.partitions) {
+			topn->partitions.push_back(partition->Copy());
+		}
+		topn->AddChild(Optimize(std::move(window.children[0])));
+		window.children[0] = std::move(topn);
+		return op;
+	}
 	if (CanOptimize(*op)) {
 		auto &limit = op->Cast<LogicalLimit>();
 		auto &order_by = (op->children[0])->Cast<LogicalOrder>();
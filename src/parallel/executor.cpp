@@ -2,6 +2,7 @@
 
 #include "duckdb/execution/execution_context.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
 #include "duckdb/execution/operator/set/physical_cte.hpp"
 #include "duckdb/execution/physical_operator.hpp"
@@ -149,9 +150,16 @@ void Executor::SchedulePipeline(const shared_ptr<MetaPipeline> &meta_pipeline, S
 	for (auto &pipeline : pipelines) {
 		auto source = pipeline->GetSource();
 		if (source->type == PhysicalOperatorType::TABLE_SCAN) {
-			// we have to reset the source here (in the main thread), because some of our clients (looking at you, R)
-			// do not like it when threads other than the main thread call into R, for e.g., arrow scans
-			pipeline->ResetSource(true);
+			auto &table_scan = source->Cast<PhysicalTableScan>();
+			if (table_scan.dynamic_filters) {
+				// filters can be pushed into this scan by other operators during execution
+				// postpone initializing the scan until the pipeline is scheduled, i.e., until its dependencies are done
+				pipeline->ClearSource();
+			} else {
+				// we have to reset the source here (in the main thread), because some of our clients (looking at you,
+				// R) do not like it when threads other than the main thread call into R, for e.g., arrow scans
+				pipeline->ResetSource(true);
+			}
 		}
 
 		auto dependencies = meta_pipeline->GetDependencies(pipeline.get());
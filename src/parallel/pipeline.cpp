@@ -75,7 +75,7 @@ ClientContext &Pipeline::GetClientContext() {
 bool Pipeline::GetProgress(double &current_percentage, idx_t &source_cardinality) {
 	D_ASSERT(source);
 	source_cardinality = source->estimated_cardinality;
-	if (!initialized) {
+	if (!initialized || !source_state) {
 		current_percentage = 0;
 		return true;
 	}
@@ -0,0 +1,83 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter() : TableFilter(TableFilterType::BLOOM_FILTER) {
+}
+
+BloomFilter::BloomFilter(idx_t expected_count) : BloomFilter() {
+	auto block_count = MinValue<idx_t>(NextPowerOfTwo(MaxValue<idx_t>(expected_count / 4, 1)), MAX_BLOCK_COUNT);
+	blocks.resize(block_count, 0);
+}
+
+void BloomFilter::InsertHashes(Vector &hashes, idx_t count) {
+	D_ASSERT(!blocks.empty());
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto hash = hash_data[hdata.sel->get_index(i)];
+		blocks[BlockIndex(hash)] |= HashMask(hash);
+	}
+}
+
+void BloomFilter::FilterSelection(Vector &input, SelectionVector &sel, idx_t &approved_tuple_count,
+                                  ValidityMask &mask) const {
+	D_ASSERT(!blocks.empty());
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(input, hashes, sel, approved_tuple_count);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	if (mask.AllValid()) {
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			if (LookupHash(hash_data[idx])) {
+				new_sel.set_index(result_count++, idx);
+			}
+		}
+	} else {
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			if (mask.RowIsValid(idx) && LookupHash(hash_data[idx])) {
+				new_sel.set_index(result_count++, idx);
+			}
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	// a bloom filter cannot be checked against min/max statistics
+	if (!stats.CanHaveNoNull()) {
+		// all values are NULL: the filter never passes
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER(" + to_string(blocks.size() * 64) + " bits)";
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.blocks == blocks;
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	auto result = make_uniq<BloomFilter>();
+	result->blocks = blocks;
+	return std::move(result);
+}
+
+} // namespace duckdb
@@ -0,0 +1,77 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+void DynamicFilterData::SetValue(ExpressionType comparison_type, const Value &constant) {
+	D_ASSERT(comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO ||
+	         comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO);
+	if (constant.IsNull()) {
+		return;
+	}
+	lock_guard<mutex> l(lock);
+	if (initialized) {
+		// only ever tighten the filter: a looser filter would be correct, but it can pass rows that we already know
+		// are not needed
+		auto &current = filter->constant;
+		if (comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO ? !(constant < current)
+		                                                                 : !(constant > current)) {
+			return;
+		}
+		filter->constant = constant;
+		return;
+	}
+	filter = make_uniq<ConstantFilter>(comparison_type, constant);
+	initialized = true;
+}
+
+unique_ptr<ConstantFilter> DynamicFilterData::GetFilter() {
+	lock_guard<mutex> l(lock);
+	if (!initialized) {
+		return nullptr;
+	}
+	return make_uniq<ConstantFilter>(filter->comparison_type, filter->constant);
+}
+
+DynamicFilter::DynamicFilter() : TableFilter(TableFilterType::DYNAMIC_FILTER) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p) : DynamicFilter() {
+	filter_data = std::move(filter_data_p);
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!filter_data) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto filter = filter_data->GetFilter();
+	if (!filter) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto result = filter->CheckStatistics(stats);
+	if (result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+		// the filter can still become more selective, so we cannot drop it
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return result;
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	return "DYNAMIC_FILTER(" + column_name + ")";
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data == filter_data;
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() const {
+	// copies share the state of the filter, so that they observe its updates
+	return make_uniq<DynamicFilter>(filter_data);
+}
+
+} // namespace duckdb
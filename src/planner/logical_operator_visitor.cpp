@@ -42,6 +42,9 @@ void LogicalOperatorVisitor::EnumerateExpressions(LogicalOperator &op,
 		for (auto &node : order.orders) {
 			callback(&node.expression);
 		}
+		for (auto &partition : order.partitions) {
+			callback(&partition);
+		}
 		break;
 	}
 	case LogicalOperatorType::LOGICAL_DISTINCT: {
@@ -4,6 +4,10 @@ namespace duckdb {
 
 idx_t LogicalTopN::EstimateCardinality(ClientContext &context) {
 	auto child_cardinality = LogicalOperator::EstimateCardinality(context);
+	if (!partitions.empty()) {
+		// the limit applies to every partition
+		return child_cardinality;
+	}
 	if (limit >= 0 && child_cardinality < idx_t(limit)) {
 		return limit;
 	}
@@ -704,6 +704,7 @@ void LogicalTopN::Serialize(Serializer &serializer) const {
 	serializer.WritePropertyWithDefault<vector<BoundOrderByNode>>(200, "orders", orders);
 	serializer.WritePropertyWithDefault<idx_t>(201, "limit", limit);
 	serializer.WritePropertyWithDefault<idx_t>(202, "offset", offset);
+	serializer.WritePropertyWithDefault<vector<unique_ptr<Expression>>>(203, "partitions", partitions);
 }
 
 unique_ptr<LogicalOperator> LogicalTopN::Deserialize(Deserializer &deserializer) {
@@ -711,6 +712,7 @@ unique_ptr<LogicalOperator> LogicalTopN::Deserialize(Deserializer &deserializer)
 	auto limit = deserializer.ReadPropertyWithDefault<idx_t>(201, "limit");
 	auto offset = deserializer.ReadPropertyWithDefault<idx_t>(202, "offset");
 	auto result = duckdb::unique_ptr<LogicalTopN>(new LogicalTopN(std::move(orders), limit, offset));
+	deserializer.ReadPropertyWithDefault<vector<unique_ptr<Expression>>>(203, "partitions", result->partitions);
 	return std::move(result);
 }
 
@@ -5,6 +5,8 @@
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/main/config.hpp"
@@ -483,6 +485,23 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &result, const
 		return TemplatedNullSelection<true>(sel, approved_tuple_count, mask);
 	case TableFilterType::IS_NOT_NULL:
 		return TemplatedNullSelection<false>(sel, approved_tuple_count, mask);
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		bloom_filter.FilterSelection(result, sel, approved_tuple_count, mask);
+		return approved_tuple_count;
+	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			return approved_tuple_count;
+		}
+		// evaluate a snapshot of the filter, as it can be updated concurrently
+		auto constant_filter = dynamic_filter.filter_data->GetFilter();
+		if (!constant_filter) {
+			return approved_tuple_count;
+		}
+		return FilterSelection(sel, result, *constant_filter, approved_tuple_count, mask);
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
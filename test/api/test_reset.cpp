@@ -57,6 +57,7 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"debug_force_no_cross_product", {Value(true)}},
 	    {"debug_force_external", {Value(true)}},
 	    {"prefer_range_joins", {Value(true)}},
+	    {"force_partitioned_hash_join", {Value(true)}},
 	    {"allow_persistent_secrets", {Value(false)}},
 	    {"secret_directory", {"/tmp/some/path"}},
 	    {"default_secret_storage", {"custom_storage"}},